@@ -39,6 +39,11 @@ namespace lsp
             static constexpr size_t FFT_MESH_POINTS     = 640;
             static constexpr size_t FFT_XOVER_RANK_MIN  = 12;
             static constexpr size_t FFT_XOVER_FREQ_MIN  = 44100;
+            static constexpr size_t FFT_XOVER_RANK_LOW  = 9;
+            static constexpr size_t FFT_XOVER_RES_BINS  = 4;
+            static constexpr size_t FFT_XOVER_RES_DFL   = 2;
+            static constexpr size_t FIR_PART_RANK_MIN   = 6;
+            static constexpr size_t FIR_PART_DFL        = 2;
             static constexpr size_t FFT_WINDOW          = dspu::windows::HANN;
             static constexpr size_t FFT_RANK            = 13;
             static constexpr size_t REFRESH_RATE        = 20;
@@ -88,6 +93,11 @@ namespace lsp
             static constexpr float  OUT_FREQ_DFL        = 1000.0f;
             static constexpr float  OUT_FREQ_STEP       = 0.002f;
 
+            static constexpr float  DSP_LOAD_MIN        = 0.0f;
+            static constexpr float  DSP_LOAD_MAX        = 100.0f;
+            static constexpr float  DSP_LOAD_DFL        = 0.0f;
+            static constexpr float  DSP_LOAD_STEP       = 0.01f;
+
         } mb_ringmod_sc;
 
         // Plugin type metadata
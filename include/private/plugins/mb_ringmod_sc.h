@@ -23,15 +23,21 @@
 #define PRIVATE_PLUGINS_MB_RINGMOD_SC_H_
 
 #include <lsp-plug.in/dsp-units/ctl/Counter.h>
-#include <lsp-plug.in/dsp-units/util/Analyzer.h>
 #include <lsp-plug.in/dsp-units/util/Crossover.h>
-#include <lsp-plug.in/dsp-units/util/Delay.h>
-#include <lsp-plug.in/dsp-units/util/FFTCrossover.h>
-#include <lsp-plug.in/dsp-units/util/RingBuffer.h>
 #include <lsp-plug.in/dsp-units/ctl/Bypass.h>
+#include <lsp-plug.in/ipc/IExecutor.h>
+#include <lsp-plug.in/ipc/ITask.h>
 #include <lsp-plug.in/plug-fw/core/IDBuffer.h>
 #include <lsp-plug.in/plug-fw/plug.h>
 #include <private/meta/mb_ringmod_sc.h>
+#include <private/rmod/AsyncAnalyzer.h>
+#include <private/rmod/clock.h>
+#include <private/rmod/MirrorBuffer.h>
+#include <private/rmod/PartitionedCrossover.h>
+#include <private/rmod/SlidingMax.h>
+#include <private/rmod/SpectrumTap.h>
+#include <private/rmod/StereoFFTCrossover.h>
+#include <private/rmod/Worker.h>
 
 namespace lsp
 {
@@ -68,6 +74,22 @@ namespace lsp
                 {
                     MODE_IIR,
                     MODE_SPM,
+                    MODE_LL,
+                };
+
+                enum resolution_t
+                {
+                    RES_AUTO,
+                    RES_LOW,
+                    RES_NORMAL,
+                    RES_HIGH
+                };
+
+                enum threading_t
+                {
+                    MT_OFF,
+                    MT_PARALLEL,
+                    MT_PIPELINE
                 };
 
                 enum metering_t
@@ -79,6 +101,38 @@ namespace lsp
                     MTR_TOTAL
                 };
 
+                enum stage_t
+                {
+                    STG_PREMIX,
+                    STG_SC_ENVELOPE,
+                    STG_SIGNAL,
+                    STG_ANALYSIS,
+                    STG_MESHES,
+
+                    STG_TOTAL
+                };
+
+                enum mix_source_t
+                {
+                    MIX_IN,
+                    MIX_SC,
+                    MIX_LINK,
+
+                    MIX_TOTAL
+                };
+
+                enum mix_post_t
+                {
+                    MIX_POST_NONE,
+                    MIX_POST_MIN,
+                    MIX_POST_MAX
+                };
+
+                typedef struct mix_row_t
+                {
+                    float               vGain[2][MIX_TOTAL];    // Gain of each source signal of each channel
+                } mix_row_t;
+
                 typedef struct premix_t
                 {
                     float               fInToSc;                // Input -> Sidechain mix
@@ -88,6 +142,11 @@ namespace lsp
                     float               fScToIn;                // Sidechain -> Input mix
                     float               fScToLink;              // Sidechain -> Link mix
 
+                    mix_row_t           vInMix[2];              // Compiled mix of the input signal of each channel
+                    mix_row_t           vScMix[2];              // Compiled mix of the sidechain signal of each channel
+                    uint32_t            nScPost;                // Non-linear post-processing of the sidechain signal
+                    bool                bScShared;              // Both channels use the same sidechain mix
+
                     plug::IPort        *pInToSc;                // Input -> Sidechain mix
                     plug::IPort        *pInToLink;              // Input -> Link mix
                     plug::IPort        *pLinkToIn;              // Link -> Input mix
@@ -109,6 +168,7 @@ namespace lsp
                     float               fFreqStart;             // Start frequency
                     float               fFreqEnd;               // End frequency
                     float               fTauRelease;            // Release time
+                    float               fRelease;               // Release time the release coefficient has been computed for
                     float               fAmount;                // Amount
                     float               fGain;                  // Additional gain
                     uint32_t            nHold;                  // Band hold time
@@ -118,6 +178,7 @@ namespace lsp
                     bool                bActive;                // Band is active
                     bool                bOn;                    // Apply band processing
                     bool                bMute;                  // Mute band
+                    bool                bUpdChart;              // Need to update the transfer function
 
                     plug::IPort        *pSolo;                  // Solo band
                     plug::IPort        *pMute;                  // Mute band
@@ -134,13 +195,17 @@ namespace lsp
 
                 typedef struct ch_band_t
                 {
-                    dspu::RingBuffer    sEnvDelay;              // Delay for envelope
+                    rmod::MirrorBuffer  sEnvDelay;              // Delay for envelope
+                    rmod::SlidingMax    sEnvMax;                // Maximum of the envelope over lookahead and duck window
 
                     float              *vEnvelope;              // Band-filtered sidechain envelope
+                    float              *vBandData;              // Band-filtered signal stored by the shared crossover or delayed envelope in pipelined mode
 
                     uint32_t            nHold;                  // Hold time
                     float               fPeak;                  // Current peak value
                     float               fReduction;             // Reduction level
+                    rmod::timing_t      sScTiming;              // Time spent for sidechain band processing
+                    rmod::timing_t      sTiming;                // Time spent for signal band processing
 
                     plug::IPort        *pReduction;             // Reduction level meters
                 } ch_band_t;
@@ -148,13 +213,11 @@ namespace lsp
                 typedef struct channel_t
                 {
                     dspu::Bypass        sBypass;                // Bypass
-                    dspu::Delay         sInDelay;               // Delay for input signal
-                    dspu::Delay         sScDelay;               // Delay for the sidechain signal
-                    dspu::Delay         sDryDelay;              // Delay for dry (unprocessed) signal
+                    rmod::MirrorBuffer  sInDelay;               // Delay for input signal
+                    rmod::MirrorBuffer  sScDelay;               // Delay for the sidechain signal
+                    rmod::MirrorBuffer  sDryDelay;              // Delay for dry (unprocessed) signal
                     dspu::Crossover     sCrossover;             // Crossover
                     dspu::Crossover     sScCrossover;           // Sidechain Crossover
-                    dspu::FFTCrossover  sFFTCrossover;          // FFT crossover
-                    dspu::FFTCrossover  sFFTScCrossover;        // Sidechain FFT crossover
                     ch_band_t           vBands[meta::mb_ringmod_sc::BANDS_MAX]; // Band processors
 
                     float              *vIn;                    // Plugin input buffer pointer
@@ -164,11 +227,10 @@ namespace lsp
 
                     float              *vInPtr;                 // Current pointer to the input data after pre-mix stage
                     float              *vScPtr;                 // Current pointer to the sidechain data after pre-mix stage
-                    float              *vLinkPtr;               // Current pointer to the link data after pre-mix stage
                     float              *vOutPtr;                // Current pointer to output buffer after pre-mix stage
+                    const float        *vInDelayPtr;            // Current pointer to the latency-compensated input data
 
                     float              *vTmpIn;                 // Replacement buffer for input (premix)
-                    float              *vTmpLink;               // Replacement buffer for link (premix)
                     float              *vTmpSc;                 // Replacement buffer for sidechain (premix)
 
                     float              *vDataIn;                // Input data buffer after crossover
@@ -180,6 +242,7 @@ namespace lsp
 
                     float               vMeters[MTR_TOTAL];     // Level meters
                     bool                bFft[MTR_TOTAL];        // FFT analysis flags
+                    bool                bShared;                // Input and sidechain are split by the same crossover
 
                     plug::IPort        *pIn;                    // Input port
                     plug::IPort        *pOut;                   // Output port
@@ -189,23 +252,80 @@ namespace lsp
                     plug::IPort        *pMeters[MTR_TOTAL];     // Level meters
                 } channel_t;
 
+                typedef struct mt_task_t
+                {
+                    mb_ringmod_sc      *pSelf;                  // Plugin
+                    channel_t          *pChannel;               // Channel to process
+                    size_t              nSamples;               // Number of samples to process
+                } mt_task_t;
+
+                /**
+                 * The task which starts and stops the helper threads outside of the audio thread.
+                 * The audio thread requests the state of threads before submitting the task,
+                 * the task reports the actual state of threads after the completion
+                 */
+                class ThreadControl: public ipc::ITask
+                {
+                    private:
+                        rmod::Worker           *pWorker;            // Worker to control
+                        rmod::AsyncAnalyzer    *pAnalyzer;          // Analyzer to control
+                        bool                    bWorker;            // The worker thread is running
+                        bool                    bAnalyzer;          // The analyzer thread is running
+
+                    public:
+                        explicit ThreadControl(rmod::Worker *worker, rmod::AsyncAnalyzer *analyzer);
+                        ThreadControl(const ThreadControl &) = delete;
+                        ThreadControl(ThreadControl &&) = delete;
+                        virtual ~ThreadControl() override;
+
+                        ThreadControl & operator = (const ThreadControl &) = delete;
+                        ThreadControl & operator = (ThreadControl &&) = delete;
+
+                    public:
+                        void                request(bool worker, bool analyzer);
+                        inline bool         worker() const          { return bWorker;       }
+                        inline bool         analyzer() const        { return bAnalyzer;     }
+
+                    public:
+                        virtual status_t    run() override;
+                };
+
             protected:
                 size_t              nChannels;              // Number of channels
                 channel_t          *vChannels;              // Delay channels
-                dspu::Analyzer      sAnalyzer;              // Analyzer
+                rmod::AsyncAnalyzer sAnalyzer;              // Analyzer running on the separate thread
                 dspu::Counter       sCounter;               // Sync counter
+                rmod::StereoFFTCrossover    sFFTCrossover;      // FFT crossover for all channels
+                rmod::StereoFFTCrossover    sFFTScCrossover;    // Sidechain FFT crossover for all channels
+                rmod::SpectrumTap           sInTap;             // Spectrum of input taken from the FFT crossover frames
+                rmod::SpectrumTap           sScTap;             // Spectrum of sidechain taken from the FFT crossover frames
+                rmod::PartitionedCrossover  sFIRCrossover;      // Low-latency FIR crossover for all channels
+                rmod::PartitionedCrossover  sFIRScCrossover;    // Low-latency sidechain FIR crossover for all channels
+                rmod::Worker        sWorker;                // Worker thread for multi-threaded processing
+                ThreadControl       sThreadControl;         // Task which starts and stops the helper threads
+                ipc::IExecutor     *pExecutor;              // Executor for the deferred tasks
+                mt_task_t           sTask;                  // Task for the worker thread
                 split_t             vSplits[meta::mb_ringmod_sc::BANDS_MAX - 1];    // Band splits
                 band_t              vBands[meta::mb_ringmod_sc::BANDS_MAX];         // Bands
                 float              *vBuffer;                // Temporary buffer for audio processing
                 float              *vEmptyBuffer;           // Empty buffer filled with zeros
                 float              *vFreqs;                 // Frequencies
-                uint32_t           *vIndexes;               // Frequency indexes
                 premix_t            sPremix;                // Sidechain pre-mix
+                rmod::timing_t      vTiming[STG_TOTAL];     // Time spent for each processing stage
+                rmod::timing_t      sTiming;                // Time spent for the whole processing
+                size_t              nTimingSamples;         // Number of samples processed during the timing window
+                uint32_t            nIdleSamples;           // Number of silent samples on the input
+                uint32_t            nIdleDelay;             // Number of silent samples required to enter the idle state
+                uint32_t            nSliceSize;             // Number of samples processed by all stages at once
+                uint32_t            nSliceHint;             // Requested slice size, zero for automatic selection
 
                 uint32_t            nType;                  // Sidechain type
                 uint32_t            nSource;                // Sidechain source
                 uint32_t            nMode;                  // Crossover mode
+                uint32_t            nSlope;                 // Crossover slope
+                uint32_t            nPartRank;              // Rank of the partition size for low-latency mode
                 uint32_t            nLatency;               // Lookahead-related latency
+                uint32_t            nThreading;             // Multi-threaded processing mode
                 float               fInGain;                // Input signal gain
                 float               fScGain;                // Sidechain gain
                 float               fDryGain;               // Dry gain
@@ -218,6 +338,12 @@ namespace lsp
                 bool                bInvert;                // Invert sidechain processing
                 bool                bOutIn;                 // Output input signal
                 bool                bOutSc;                 // Output sidechain signal
+                bool                bScMono;                // Both channels use the same sidechain signal
+                bool                bIdle;                  // The plugin is idle, processing is skipped
+                bool                bWorker;                // The worker thread is available for processing
+                bool                bAnalyzer;              // The analyzer thread is running
+                bool                bUiActive;              // The UI is attached, analysis and metering are performed
+                bool                bDisplayDrawn;          // The inline display has been drawn since the last mesh update
 
                 core::IDBuffer     *pIDisplay;              // Inline display buffer
 
@@ -232,6 +358,8 @@ namespace lsp
                 plug::IPort        *pType;                  // Type of sidechain
                 plug::IPort        *pMode;                  // Mode of sidechain
                 plug::IPort        *pSlope;                 // Slope of sidechain
+                plug::IPort        *pPartition;             // Partition size for low-latency mode
+                plug::IPort        *pResolution;            // Resolution of linear-phase crossovers
                 plug::IPort        *pDry;                   // Dry gain
                 plug::IPort        *pWet;                   // Wet gain
                 plug::IPort        *pDryWet;                // Dry/Wet balance
@@ -240,26 +368,56 @@ namespace lsp
                 plug::IPort        *pShift;                 // FFT shift
                 plug::IPort        *pFilterMesh;            // Filter meshes
                 plug::IPort        *pMeterMesh;             // Metering meshes
+                plug::IPort        *pDspLoad;               // DSP load meter
                 plug::IPort        *pSource;                // Sidechain source
+                plug::IPort        *pThreading;             // Multi-threaded processing mode
 
                 uint8_t            *pData;                  // Allocated data
 
             protected:
                 static void         process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t samples);
                 static void         process_sc_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t samples);
+                static void         apply_band(mb_ringmod_sc *self, channel_t *c, size_t band, const float *data, size_t sample, size_t samples);
+                static void         process_spectrum(void *object, void *subject, const float *fft, size_t rank);
                 static size_t       select_fft_rank(size_t sample_rate);
                 static size_t       decode_iir_slope(size_t slope);
                 static float        decode_spm_slope(size_t slope);
+                static void         sc_split_task(void *arg);
+                static void         sc_follow_task(void *arg);
+                static void         channel_signal_task(void *arg);
 
             protected:
                 void                do_destroy();
+                uint32_t            decode_threading(size_t value) const;
+                void                update_threads(bool worker, bool analyzer);
+                void                sync_threads();
+                uint32_t            select_slice_size() const;
+                void                init_xover_crossovers(size_t max_rank);
+                void                update_xover_rank(size_t rank);
+                size_t              select_xover_rank(band_t * const *plan, size_t plan_size) const;
+                void                process_crossover(const float *left, const float *right, size_t samples);
+                void                process_sc_crossover(const float *left, const float *right, size_t samples);
                 void                update_premix();
+                float              *mix_stream(float *dst, const mix_row_t *row, float * const *src, size_t samples);
                 void                premix_channels(size_t samples);
-                void                process_sidechain_type(size_t samples);
+                void                prepare_sidechain();
                 void                process_sidechain_envelope(size_t samples);
+                void                follow_sidechain(size_t samples);
+                void                apply_envelope_delays(size_t samples);
+                void                append_envelopes(size_t samples);
+                void                process_pipelined(size_t samples);
+                void                process_sc_split(channel_t *c, size_t samples);
                 void                process_signal(size_t samples);
+                void                process_channel_signal(channel_t *c, size_t samples);
+                void                process_channel_output(channel_t *c, size_t samples);
+                bool                submit_right_channel(rmod::Worker::task_t task, size_t samples);
+                void                process_analysis(size_t samples);
+                void                commit_timings();
+                bool                detect_silence(size_t samples);
+                void                process_idle(size_t samples);
                 void                update_meshes();
                 void                output_meshes();
+                void                get_tap_spectrum(size_t channel, size_t meter, const float *tr, float *dst) const;
                 void                output_meters();
                 size_t              build_split_plan(band_t **plan);
 
@@ -279,6 +437,7 @@ namespace lsp
                 virtual void        update_sample_rate(long sr) override;
                 virtual void        update_settings() override;
                 virtual void        ui_activated() override;
+                virtual void        ui_deactivated() override;
                 virtual void        process(size_t samples) override;
                 virtual bool        inline_display(plug::ICanvas *cv, size_t width, size_t height) override;
                 virtual void        dump(dspu::IStateDumper *v) const override;
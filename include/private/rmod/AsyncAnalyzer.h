@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_ASYNCANALYZER_H_
+#define PRIVATE_RMOD_ASYNCANALYZER_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Analyzer.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+#include <private/rmod/Semaphore.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Spectrum analyzer which performs the FFT analysis on the separate low-priority
+         * thread instead of the audio thread.
+         *
+         * The audio thread only copies the samples of the enabled channels into the
+         * lock-free single-producer single-consumer ring buffer and wakes up the analyzer
+         * thread each time the data for the next publication has been collected. The
+         * analyzer thread feeds the pending samples to the analyzer and publishes the
+         * spectra reduced to the list of mesh points at the refresh rate. Spectra are
+         * exchanged through the triple buffer, so neither side waits for the other one and
+         * the reader always gets the complete set of spectra. If the analyzer thread does
+         * not keep up, the samples that do not fit into the ring buffer are dropped.
+         *
+         * All settings are changed by the audio thread and applied by the analyzer thread
+         * on the next wake-up. The analyzer thread is not started by init(), it should be
+         * started outside of the audio thread when the analysis is needed for the first
+         * time. While the analysis is inactive, the analyzer thread stays blocked and does
+         * not consume CPU. The number of channels is limited by 32.
+         */
+        class AsyncAnalyzer
+        {
+            protected:
+                dspu::Analyzer          sAnalyzer;          // Analyzer, accessed by the analyzer thread only
+                size_t                  nChannels;          // Number of channels
+                size_t                  nRank;              // FFT rank
+                size_t                  nPoints;            // Number of mesh points in each spectrum
+                size_t                  nCapacity;          // Capacity of the ring buffer of each channel, power of two
+                float                   fRate;              // Refresh rate
+                float                   fStart;             // Frequency of the first mesh point
+                float                   fStop;              // Frequency of the last mesh point
+                size_t                  nFront;             // Spectrum buffer owned by the reader
+                size_t                  nBack;              // Spectrum buffer owned by the analyzer thread
+                size_t                  nPeriod;            // Number of samples between the publications of spectra
+                size_t                  nCountdown;         // Number of samples left before the next publication
+                size_t                  nSignal;            // Number of samples to collect before waking up the analyzer thread
+                size_t                  nPending;           // Number of samples collected since the last wake-up
+
+                // Settings are written by the audio thread before incrementing the version
+                size_t                  nSampleRate;        // Sample rate
+                uint32_t                nEnabled;           // Mask of enabled channels
+                size_t                  nWindow;            // Window function
+                size_t                  nEnvelope;          // Envelope
+                float                   fReactivity;        // Reactivity
+                float                   fShift;             // Shift gain
+                bool                    bActive;            // Analysis is active
+                bool                    bExit;              // Exit request for the analyzer thread
+
+                atomic_t                nHead;              // Number of samples written to the ring buffer
+                atomic_t                nTail;              // Number of samples read from the ring buffer
+                atomic_t                nLatest;            // Most recently published spectrum buffer and freshness flag
+                atomic_t                nVersion;           // Version of settings
+                Semaphore               sWakeup;            // Wake-up signal for the analyzer thread
+                ipc::Thread            *pThread;            // Analyzer thread
+
+                float                  *vRing;              // Ring buffers of all channels
+                float                  *vSpectrum[3];       // Triple buffer of spectra of all channels
+                float                 **vChannels;          // Pointers to the channel data passed to the analyzer
+                uint32_t               *vIndexes;           // Indexes of mesh points in the FFT spectrum
+                uint8_t                *pData;              // Allocated data
+
+            protected:
+                static status_t         thread_proc(void *arg);
+                void                    run();
+                void                    apply_settings();
+                void                    analyze();
+                void                    publish();
+                void                    mark_changed();
+                void                    update_signal();
+
+            public:
+                explicit AsyncAnalyzer();
+                AsyncAnalyzer(const AsyncAnalyzer &) = delete;
+                AsyncAnalyzer(AsyncAnalyzer &&) = delete;
+                ~AsyncAnalyzer();
+
+                AsyncAnalyzer & operator = (const AsyncAnalyzer &) = delete;
+                AsyncAnalyzer & operator = (AsyncAnalyzer &&) = delete;
+
+                /**
+                 * Construct object
+                 */
+                void                    construct();
+
+                /**
+                 * Stop the analyzer thread and destroy object
+                 */
+                void                    destroy();
+
+                /**
+                 * Initialize analyzer, the analyzer thread is not started
+                 * @param channels number of channels, at most 32
+                 * @param rank FFT rank
+                 * @param max_sr maximum sample rate
+                 * @param rate refresh rate
+                 * @param points number of mesh points in each spectrum
+                 * @param freq_min frequency of the first mesh point
+                 * @param freq_max frequency of the last mesh point
+                 * @return true on success
+                 */
+                bool                    init(size_t channels, size_t rank, size_t max_sr, float rate,
+                                            size_t points, float freq_min, float freq_max);
+
+                /**
+                 * Start the analyzer thread, should not be called from the audio thread
+                 * @return true if the analyzer thread is running
+                 */
+                bool                    start();
+
+                /**
+                 * Stop the analyzer thread, should not be called from the audio thread
+                 */
+                void                    stop();
+
+            public:
+                inline size_t           channels() const    { return nChannels;         }
+                inline size_t           points() const      { return nPoints;           }
+                inline bool             running() const     { return pThread != NULL;   }
+
+                /**
+                 * Set sample rate
+                 * @param sr sample rate
+                 */
+                void                    set_sample_rate(size_t sr);
+
+                /**
+                 * Enable or disable analysis of the channel
+                 * @param channel channel index
+                 * @param enable enable flag
+                 */
+                void                    enable_channel(size_t channel, bool enable);
+
+                /**
+                 * Check that the channel is analyzed
+                 * @param channel channel index
+                 * @return true if analysis is active and the channel is enabled
+                 */
+                bool                    channel_active(size_t channel) const;
+
+                /**
+                 * Enable or disable the analysis
+                 * @param active activity flag
+                 */
+                void                    set_activity(bool active);
+
+                /**
+                 * Set reactivity of the analyzer
+                 * @param reactivity reactivity in milliseconds
+                 */
+                void                    set_reactivity(float reactivity);
+
+                /**
+                 * Set shift gain of the analyzer
+                 * @param shift shift gain
+                 */
+                void                    set_shift(float shift);
+
+                /**
+                 * Set window function
+                 * @param window window function
+                 */
+                void                    set_window(size_t window);
+
+                /**
+                 * Set envelope
+                 * @param envelope envelope
+                 */
+                void                    set_envelope(size_t envelope);
+
+                /**
+                 * Pass the data to the analyzer thread, called by the audio thread
+                 * @param in list of channel buffers, buffers of disabled channels are not accessed
+                 * @param samples number of samples in each buffer
+                 */
+                void                    process(const float * const *in, size_t samples);
+
+                /**
+                 * Get the frequencies of the mesh points
+                 * @param frq destination buffer to store the number of mesh points
+                 */
+                void                    get_frequencies(float *frq) const;
+
+                /**
+                 * Acquire the most recently published spectra for reading
+                 * @return true if new spectra have been published since the last call
+                 */
+                bool                    sync();
+
+                /**
+                 * Get the spectrum of the channel acquired by the last sync() call
+                 * @param channel channel index
+                 * @param dst destination buffer to store the number of mesh points
+                 */
+                void                    get_spectrum(size_t channel, float *dst) const;
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                    dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_ASYNCANALYZER_H_ */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_DENORMALGUARD_H_
+#define PRIVATE_RMOD_DENORMALGUARD_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Scoped floating-point context of the DSP code: enables flush-to-zero and
+         * denormals-are-zero modes (or their analogs on the target architecture)
+         * on construction and restores the previous state of the thread on destruction.
+         * Guards can be safely nested since each of them saves and restores the whole context.
+         */
+        class DenormalGuard
+        {
+            private:
+                dsp::context_t          sCtx;               // Saved floating-point context
+
+            public:
+                inline explicit DenormalGuard()             { dsp::start(&sCtx);    }
+                DenormalGuard(const DenormalGuard &) = delete;
+                DenormalGuard(DenormalGuard &&) = delete;
+                inline ~DenormalGuard()                     { dsp::finish(&sCtx);   }
+
+                DenormalGuard & operator = (const DenormalGuard &) = delete;
+                DenormalGuard & operator = (DenormalGuard &&) = delete;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_DENORMALGUARD_H_ */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_MIRRORBUFFER_H_
+#define PRIVATE_RMOD_MIRRORBUFFER_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Ring buffer which provides contiguous read-only views of the history at any
+         * delay without wrap handling and copying.
+         *
+         * On Linux the storage is a memory file mapped twice to the adjacent virtual
+         * address ranges, so the second half of the address space mirrors the first one
+         * and any range of up to the capacity samples is contiguous in memory. On other
+         * systems (or if the mapping fails) the buffer of the double size is allocated
+         * and each write is duplicated to both halves, which gives the same views at
+         * the cost of an additional copy on write.
+         *
+         * The buffer also can serve as the delay line: the process() method appends
+         * the data and returns the view of the delayed data.
+         */
+        class MirrorBuffer
+        {
+            protected:
+                size_t              nCapacity;              // Capacity in samples
+                size_t              nHead;                  // Write position
+                size_t              nDelay;                 // Delay in samples
+                size_t              nMapSize;               // Size of each mapping in bytes, zero if not mapped
+                float              *vData;                  // Start of the buffer
+                uint8_t            *pData;                  // Allocated data for the non-mapped buffer
+
+            protected:
+                bool                map_mirrored(size_t capacity);
+
+            public:
+                explicit MirrorBuffer();
+                MirrorBuffer(const MirrorBuffer &) = delete;
+                MirrorBuffer(MirrorBuffer &&) = delete;
+                ~MirrorBuffer();
+
+                MirrorBuffer & operator = (const MirrorBuffer &) = delete;
+                MirrorBuffer & operator = (MirrorBuffer &&) = delete;
+
+                /**
+                 * Construct object
+                 */
+                void                construct();
+
+                /**
+                 * Destroy object
+                 */
+                void                destroy();
+
+                /**
+                 * Initialize buffer, the contents is cleared
+                 * @param capacity minimum capacity of the buffer in samples, the actual
+                 *   capacity can be larger due to the alignment to the memory pages
+                 * @return true on success
+                 */
+                bool                init(size_t capacity);
+
+            public:
+                inline size_t       capacity() const        { return nCapacity;             }
+                inline size_t       delay() const           { return nDelay;                }
+                inline bool         mirrored() const        { return nMapSize > 0;          }
+
+                /**
+                 * Set the delay for the process() method
+                 * @param delay delay in samples
+                 */
+                inline void         set_delay(size_t delay) { nDelay = delay;               }
+
+                /**
+                 * Clear the buffer contents
+                 */
+                void                clear();
+
+                /**
+                 * Append the data to the buffer
+                 * @param src data to append
+                 * @param count number of samples to append, should not be greater than capacity
+                 */
+                void                append(const float *src, size_t count);
+
+                /**
+                 * Get the view of the history. The view remains valid until the next
+                 * modification of the buffer.
+                 * @param offset number of samples between the start of the view and the head of
+                 *   the buffer, should not be greater than capacity
+                 * @return pointer to the contiguous range of offset samples
+                 */
+                inline const float *tail(size_t offset) const
+                {
+                    return &vData[(nHead + nCapacity - offset) % nCapacity];
+                }
+
+                /**
+                 * Append the data to the buffer and get the view of the data delayed
+                 * by the configured delay. The view remains valid until the next
+                 * modification of the buffer.
+                 * @param src data to append
+                 * @param count number of samples to append, the sum of count and delay
+                 *   should not be greater than capacity
+                 * @return pointer to the delayed data
+                 */
+                inline const float *process(const float *src, size_t count)
+                {
+                    append(src, count);
+                    return tail(count + nDelay);
+                }
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_MIRRORBUFFER_H_ */
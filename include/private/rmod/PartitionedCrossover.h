@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_PARTITIONEDCROSSOVER_H_
+#define PRIVATE_RMOD_PARTITIONEDCROSSOVER_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Crossover.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Linear-phase crossover with low latency that processes two channels at once.
+         *
+         * The band filters are built as linear-phase FIR filters from the band masks and
+         * applied with uniformly partitioned overlap-save convolution. Each partition of the
+         * filter is convolved with the corresponding block of the input signal in frequency
+         * domain, so the latency of the crossover is equal to the partition size plus the
+         * group delay of the filter which is a half of the filter length.
+         *
+         * Left and right signals are packed into real and imaginary parts of the complex signal.
+         * Since the filters are real, the real part of the convolution result is the band
+         * of the left channel and the imaginary part is the band of the right channel.
+         */
+        class PartitionedCrossover
+        {
+            protected:
+                typedef struct handler_t
+                {
+                    dspu::crossover_func_t  pFunc;          // Handler function
+                    void                   *pObject;        // Object to pass to the handler
+                    void                   *pSubject;       // Subject to pass to the handler
+                } handler_t;
+
+                typedef struct band_t
+                {
+                    float               fHpfFreq;           // Frequency of the hi-pass filter
+                    float               fHpfSlope;          // Slope of the hi-pass filter, dB/octave
+                    float               fLpfFreq;           // Frequency of the lo-pass filter
+                    float               fLpfSlope;          // Slope of the lo-pass filter, dB/octave
+                    bool                bHpf;               // Hi-pass filter is enabled
+                    bool                bLpf;               // Lo-pass filter is enabled
+                    bool                bEnabled;           // Band is enabled
+                    bool                bMuted;             // Band is muted, the processing is skipped
+                    bool                bClear;             // Need to clear band buffers
+                    bool                bUpdate;            // Need to update the band kernel
+
+                    float              *vKernel;            // Spectra of filter partitions, packed complex numbers
+                    float              *vOut[2];            // Output data of the band for each channel
+                    handler_t           vHandlers[2];       // Handlers for each channel
+                } band_t;
+
+            protected:
+                size_t              nRank;                  // Rank of the filter length
+                size_t              nMaxRank;               // Maximum rank of the filter length, the memory is allocated for
+                size_t              nPartRank;              // Rank of the partition size
+                size_t              nBands;                 // Number of bands
+                size_t              nSampleRate;            // Sample rate
+                size_t              nOffset;                // Offset of the current sample in the partition
+                size_t              nHead;                  // Position of the latest spectrum in the delay line
+                bool                bUpdate;                // Need to update filters
+                band_t             *vBands;                 // List of bands
+                float              *vInBuf[2];              // Input buffer for each channel
+                float              *vFdl;                   // Frequency-domain delay line, packed complex numbers
+                float              *vAcc;                   // Convolution accumulator, packed complex numbers
+                float              *vTmp;                   // Temporary buffer, packed complex numbers
+                float              *vFir;                   // Buffer for building the filter, packed complex numbers
+                float              *vImpulse;               // Impulse response of the filter
+                uint8_t            *pData;                  // Allocated data
+
+            protected:
+                void                update_kernels();
+                void                process_partition();
+
+            public:
+                explicit PartitionedCrossover();
+                PartitionedCrossover(const PartitionedCrossover &) = delete;
+                PartitionedCrossover(PartitionedCrossover &&) = delete;
+                ~PartitionedCrossover();
+
+                PartitionedCrossover & operator = (const PartitionedCrossover &) = delete;
+                PartitionedCrossover & operator = (PartitionedCrossover &&) = delete;
+
+                /**
+                 * Construct object
+                 */
+                void                construct();
+
+                /**
+                 * Destroy object
+                 */
+                void                destroy();
+
+                /**
+                 * Initialize crossover. The memory is allocated for any partition size and
+                 * any filter length up to the initial one, so both can be changed later without
+                 * reallocation
+                 * @param rank maximum rank of the filter length, the crossover is initialized with this rank
+                 * @param part_rank rank of the partition size, should be less than rank
+                 * @param bands number of bands
+                 * @return true on success
+                 */
+                bool                init(size_t rank, size_t part_rank, size_t bands);
+
+            public:
+                inline size_t       rank() const            { return nRank;                 }
+                inline size_t       max_rank() const        { return nMaxRank;              }
+                inline size_t       partition_rank() const  { return nPartRank;             }
+                inline size_t       bands() const           { return nBands;                }
+                inline bool         needs_update() const    { return bUpdate;               }
+
+                /**
+                 * Get the latency of the crossover: the partition size plus group delay of the filter
+                 * @return latency in samples
+                 */
+                inline size_t       latency() const         { return (nRank > 0) ? (size_t(1) << nPartRank) + (size_t(1) << (nRank - 1)) : 0; }
+
+                /**
+                 * Set sample rate
+                 * @param sr sample rate
+                 */
+                void                set_sample_rate(size_t sr);
+
+                /**
+                 * Change the partition size, does not allocate memory. The internal state
+                 * of the crossover is cleared and the filters are rebuilt
+                 * @param part_rank rank of the partition size, should be less than the rank
+                 *   of the filter length
+                 */
+                void                set_partition(size_t part_rank);
+
+                /**
+                 * Change the filter length and the partition size, does not allocate memory.
+                 * The internal state of the crossover is cleared and the filters are rebuilt
+                 * @param rank rank of the filter length, not greater than the maximum rank
+                 * @param part_rank rank of the partition size, should be less than rank
+                 */
+                void                set_rank(size_t rank, size_t part_rank);
+
+                /**
+                 * Enable or disable band
+                 * @param band band number
+                 * @param enable enable flag
+                 */
+                void                enable_band(size_t band, bool enable);
+
+                /**
+                 * Mute or unmute band. Muted band keeps it's settings but is not processed
+                 * and it's handlers are not called
+                 * @param band band number
+                 * @param mute mute flag
+                 */
+                void                mute_band(size_t band, bool mute);
+
+                /**
+                 * Set the parameters of the hi-pass filter of the band
+                 * @param band band number
+                 * @param freq cutoff frequency
+                 * @param slope slope of the filter, dB/octave, negative value
+                 * @param enabled enable flag
+                 */
+                void                set_hpf(size_t band, float freq, float slope, bool enabled);
+
+                /**
+                 * Set the parameters of the lo-pass filter of the band
+                 * @param band band number
+                 * @param freq cutoff frequency
+                 * @param slope slope of the filter, dB/octave, negative value
+                 * @param enabled enable flag
+                 */
+                void                set_lpf(size_t band, float freq, float slope, bool enabled);
+
+                /**
+                 * Set band handler for the specific channel
+                 * @param channel channel number: 0 for left, 1 for right
+                 * @param band band number
+                 * @param func handler function
+                 * @param object object to pass to the function
+                 * @param subject subject to pass to the function
+                 */
+                void                set_handler(size_t channel, size_t band, dspu::crossover_func_t func, void *object, void *subject);
+
+                /**
+                 * Update filters of the bands which settings have been changed
+                 */
+                void                update_settings();
+
+                /**
+                 * Clear the internal state of the crossover
+                 */
+                void                clear();
+
+                /**
+                 * Get the frequency chart of the band
+                 * @param band band number
+                 * @param tr destination buffer to store magnitude
+                 * @param f list of frequencies
+                 * @param count number of frequencies
+                 */
+                void                freq_chart(size_t band, float *tr, const float *f, size_t count) const;
+
+                /**
+                 * Process the signal and call the band handlers
+                 * @param left left channel
+                 * @param right right channel, may be NULL for mono processing,
+                 *   handlers of the right channel are not called in this case
+                 * @param samples number of samples to process
+                 */
+                void                process(const float *left, const float *right, size_t samples);
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_PARTITIONEDCROSSOVER_H_ */
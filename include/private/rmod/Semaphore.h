@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_RMOD_SEMAPHORE_H_
+#define PRIVATE_RMOD_SEMAPHORE_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+
+#if defined(PLATFORM_WINDOWS)
+    #include <windows.h>
+#elif !defined(PLATFORM_LINUX)
+    #include <pthread.h>
+#endif /* PLATFORM_WINDOWS */
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Counting semaphore that allows to hand off the job between the audio thread
+         * and the helper thread without locks. The waiting side spins for the specified
+         * number of iterations and then blocks until the signal is posted. The thread
+         * blocks on the futex on Linux, on the native semaphore on Windows and on the
+         * condition variable on other systems. The posting side enters the kernel only
+         * if there is a blocked thread.
+         */
+        class Semaphore
+        {
+            protected:
+                atomic_t            nCount;             // Number of posted signals
+                atomic_t            nWaiters;           // Number of sleeping threads
+            #if defined(PLATFORM_WINDOWS)
+                HANDLE              hSemaphore;         // Native semaphore to block on
+            #elif !defined(PLATFORM_LINUX)
+                pthread_mutex_t     sMutex;             // Mutex which protects the condition
+                pthread_cond_t      sCond;              // Condition to block on
+            #endif /* PLATFORM_WINDOWS */
+
+            protected:
+                bool                try_acquire();
+                void                sleep();
+                void                wake();
+
+            public:
+                explicit Semaphore();
+                Semaphore(const Semaphore &) = delete;
+                Semaphore(Semaphore &&) = delete;
+                ~Semaphore();
+
+                Semaphore & operator = (const Semaphore &) = delete;
+                Semaphore & operator = (Semaphore &&) = delete;
+
+            public:
+                /**
+                 * Post the signal and wake up the waiting thread
+                 */
+                void                post();
+
+                /**
+                 * Wait for the signal and consume it
+                 * @param spin number of spin iterations before going to sleep
+                 */
+                void                wait(size_t spin);
+
+                /**
+                 * Consume all posted signals
+                 */
+                void                reset();
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_SEMAPHORE_H_ */
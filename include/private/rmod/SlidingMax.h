@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_SLIDINGMAX_H_
+#define PRIVATE_RMOD_SLIDINGMAX_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Running maximum of the non-negative stream over the sliding window of the
+         * fixed length: dst[i] = max(src[i - window + 1] ... src[i]).
+         *
+         * The streaming form of the van Herk/Gil-Werman algorithm is used. The stream
+         * is split into the blocks of the window length. For each sample the window
+         * covers the suffix of the previous block and the prefix of the current block,
+         * so the result is the maximum of the running prefix maximum of the current block
+         * and the suffix maximum of the previous block which is computed once per block.
+         * This gives three comparisons per sample regardless of the window length, and
+         * the final combination of two sequences is performed with the vectorized code.
+         *
+         * Samples preceding the start of the stream are considered to be zero.
+         */
+        class SlidingMax
+        {
+            protected:
+                size_t              nCapacity;              // Maximum window length
+                size_t              nWindow;                // Current window length
+                size_t              nPos;                   // Position in the current block
+                float               fPrefix;                // Prefix maximum of the current block
+                float              *vSuffix;                // Suffix maximums of the previous block, window + 1 elements
+                float              *vBlock;                 // Samples of the current block
+                uint8_t            *pData;                  // Allocated data
+
+            protected:
+                void                complete_block();
+
+            public:
+                explicit SlidingMax();
+                SlidingMax(const SlidingMax &) = delete;
+                SlidingMax(SlidingMax &&) = delete;
+                ~SlidingMax();
+
+                SlidingMax & operator = (const SlidingMax &) = delete;
+                SlidingMax & operator = (SlidingMax &&) = delete;
+
+                /**
+                 * Construct object
+                 */
+                void                construct();
+
+                /**
+                 * Destroy object
+                 */
+                void                destroy();
+
+                /**
+                 * Initialize object
+                 * @param capacity maximum length of the window
+                 * @return true on success
+                 */
+                bool                init(size_t capacity);
+
+            public:
+                inline size_t       capacity() const        { return nCapacity;     }
+                inline size_t       window() const          { return nWindow;       }
+
+                /**
+                 * Set the length of the window, clears the state if the length has changed
+                 * @param window length of the window, limited by the capacity, the window
+                 *   of zero or one sample passes the stream unchanged
+                 */
+                void                set_window(size_t window);
+
+                /**
+                 * Clear the state: all previous samples are considered to be zero
+                 */
+                void                clear();
+
+                /**
+                 * Process the stream
+                 * @param dst destination buffer, can be the same to the source buffer
+                 * @param src source buffer of non-negative values
+                 * @param count number of samples to process
+                 */
+                void                process(float *dst, const float *src, size_t count);
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_SLIDINGMAX_H_ */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_SPECTRUMTAP_H_
+#define PRIVATE_RMOD_SPECTRUMTAP_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Spectrum analyzer fed by the frames of the linear-phase FFT crossover.
+         *
+         * The crossover already computes the spectrum of the windowed stereo frame packed
+         * as L + iR, so the magnitude spectra of both channels can be obtained without any
+         * additional FFT. The spectra of channels are unpacked only at the mesh points:
+         *   L[k] = (Z[k] + conj(Z[N-k])) / 2,
+         *   R[k] = (Z[k] - conj(Z[N-k])) / 2i.
+         *
+         * The magnitudes are normalized by the frame size and smoothed between frames with
+         * the reactivity of the analyzer, so the result matches the scale of dspu::Analyzer
+         * with the white noise envelope. The resolution is defined by the rank of the crossover
+         * and the mesh points which fall into one FFT bin get the same value.
+         */
+        class SpectrumTap
+        {
+            protected:
+                size_t              nPoints;                // Number of mesh points
+                size_t              nSampleRate;            // Sample rate
+                size_t              nRank;                  // FFT rank of the last processed frame
+                float               fReactivity;            // Reactivity in milliseconds
+                float               fShift;                 // Shift gain
+                float               fTau;                   // Smoothing coefficient per frame
+                float               fNorm;                  // Normalizing coefficient
+                bool                bActive;                // Spectrum is computed
+                bool                bUpdate;                // Need to update settings
+
+                float              *vFreqs;                 // Frequencies of mesh points
+                uint32_t           *vIndexes;               // Indexes of mesh points in the FFT spectrum
+                float              *vSpectrum[2];           // Smoothed spectrum of each channel
+                uint8_t            *pData;                  // Allocated data
+
+            protected:
+                void                update_settings(size_t rank);
+
+            public:
+                explicit SpectrumTap();
+                SpectrumTap(const SpectrumTap &) = delete;
+                SpectrumTap(SpectrumTap &&) = delete;
+                ~SpectrumTap();
+
+                SpectrumTap & operator = (const SpectrumTap &) = delete;
+                SpectrumTap & operator = (SpectrumTap &&) = delete;
+
+                /**
+                 * Construct object
+                 */
+                void                construct();
+
+                /**
+                 * Destroy object
+                 */
+                void                destroy();
+
+                /**
+                 * Initialize object
+                 * @param freqs frequencies of mesh points, copied
+                 * @param points number of mesh points
+                 * @return true on success
+                 */
+                bool                init(const float *freqs, size_t points);
+
+            public:
+                inline size_t       points() const          { return nPoints;               }
+                inline bool         active() const          { return bActive;               }
+
+                /**
+                 * Set sample rate
+                 * @param sr sample rate
+                 */
+                void                set_sample_rate(size_t sr);
+
+                /**
+                 * Set reactivity
+                 * @param reactivity reactivity in milliseconds
+                 */
+                void                set_reactivity(float reactivity);
+
+                /**
+                 * Set shift gain
+                 * @param shift shift gain
+                 */
+                void                set_shift(float shift);
+
+                /**
+                 * Enable or disable computation of the spectrum, frames are ignored
+                 * while the computation is disabled
+                 * @param active activity flag
+                 */
+                void                set_active(bool active);
+
+                /**
+                 * Reset the spectrum
+                 */
+                void                clear();
+
+                /**
+                 * Process the spectrum of the frame
+                 * @param fft packed complex spectrum of the windowed frame L + iR
+                 * @param rank FFT rank of the frame
+                 */
+                void                process(const float *fft, size_t rank);
+
+                /**
+                 * Get the smoothed spectrum of the channel
+                 * @param channel channel number: 0 for left, 1 for right
+                 * @param dst destination buffer to store the number of mesh points
+                 */
+                void                get_spectrum(size_t channel, float *dst) const;
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_SPECTRUMTAP_H_ */
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_STEREOFFTCROSSOVER_H_
+#define PRIVATE_RMOD_STEREOFFTCROSSOVER_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Crossover.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Linear-phase FFT crossover that processes two channels at once.
+         *
+         * Left and right signals are packed into real and imaginary parts of the
+         * complex signal and transformed with a single complex FFT. Since band masks
+         * are real and symmetric, the spectrum of each band still is a sum of two
+         * hermitian spectra, so after the inverse transform the real part contains
+         * the band of the left channel and the imaginary part contains the band of the
+         * right channel. This gives one direct and one reverse FFT per band for both
+         * channels instead of one per band per channel.
+         *
+         * The frame is processed with 50% overlap and periodic Hann window which sums to
+         * unity, so the latency of the crossover is equal to the frame size.
+         */
+        class StereoFFTCrossover
+        {
+            public:
+                /**
+                 * Frame spectrum handler, called once per frame after the direct transform
+                 * @param object object passed to the handler
+                 * @param subject subject passed to the handler
+                 * @param fft packed complex spectrum of the windowed frame, the real part of the
+                 *   frame contains the left channel and the imaginary part contains the right channel
+                 * @param rank FFT rank of the frame
+                 */
+                typedef void (* spectrum_func_t)(void *object, void *subject, const float *fft, size_t rank);
+
+            protected:
+                typedef struct handler_t
+                {
+                    dspu::crossover_func_t  pFunc;          // Handler function
+                    void                   *pObject;        // Object to pass to the handler
+                    void                   *pSubject;       // Subject to pass to the handler
+                } handler_t;
+
+                typedef struct band_t
+                {
+                    float               fHpfFreq;           // Frequency of the hi-pass filter
+                    float               fHpfSlope;          // Slope of the hi-pass filter, dB/octave
+                    float               fLpfFreq;           // Frequency of the lo-pass filter
+                    float               fLpfSlope;          // Slope of the lo-pass filter, dB/octave
+                    bool                bHpf;               // Hi-pass filter is enabled
+                    bool                bLpf;               // Lo-pass filter is enabled
+                    bool                bEnabled;           // Band is enabled
+                    bool                bMuted;             // Band is muted, the processing is skipped
+                    bool                bClear;             // Need to clear band buffers
+                    bool                bUpdate;            // Need to update the band mask
+
+                    float              *vMask;              // Band mask, stored as packed complex numbers
+                    float              *vAcc;               // Overlap-add accumulator, packed complex numbers
+                    float              *vOut[2];            // Output data of the band for each channel
+                    handler_t           vHandlers[2];       // Handlers for each channel
+                } band_t;
+
+            protected:
+                size_t              nRank;                  // FFT rank
+                size_t              nMaxRank;               // Maximum FFT rank, the memory is allocated for
+                size_t              nBands;                 // Number of bands
+                size_t              nSampleRate;            // Sample rate
+                size_t              nOffset;                // Offset of the current sample in the frame hop
+                float               fPhase;                 // Phase of the frame, in parts of the hop
+                bool                bUpdate;                // Need to update band masks
+                band_t             *vBands;                 // List of bands
+                spectrum_func_t     pSpecFunc;              // Frame spectrum handler
+                void               *pSpecObject;            // Object to pass to the frame spectrum handler
+                void               *pSpecSubject;           // Subject to pass to the frame spectrum handler
+                float              *vWindow;                // Window function
+                float              *vInBuf[2];              // Input buffer for each channel
+                float              *vFft;                   // FFT buffer, packed complex numbers
+                float              *vTmp;                   // Temporary buffer, packed complex numbers
+                uint8_t            *pData;                  // Allocated data
+
+            protected:
+                void                update_window();
+                void                update_masks();
+                void                process_frame();
+
+            public:
+                explicit StereoFFTCrossover();
+                StereoFFTCrossover(const StereoFFTCrossover &) = delete;
+                StereoFFTCrossover(StereoFFTCrossover &&) = delete;
+                ~StereoFFTCrossover();
+
+                StereoFFTCrossover & operator = (const StereoFFTCrossover &) = delete;
+                StereoFFTCrossover & operator = (StereoFFTCrossover &&) = delete;
+
+                /**
+                 * Construct object
+                 */
+                void                construct();
+
+                /**
+                 * Destroy object
+                 */
+                void                destroy();
+
+                /**
+                 * Initialize crossover
+                 * @param rank maximum FFT rank, the crossover is initialized with this rank
+                 * @param bands number of bands
+                 * @return true on success
+                 */
+                bool                init(size_t rank, size_t bands);
+
+            public:
+                inline size_t       rank() const            { return nRank;                 }
+                inline size_t       max_rank() const        { return nMaxRank;              }
+                inline size_t       bands() const           { return nBands;                }
+                inline size_t       latency() const         { return size_t(1) << nRank;    }
+                inline bool         needs_update() const    { return bUpdate;               }
+
+                /**
+                 * Set sample rate
+                 * @param sr sample rate
+                 */
+                void                set_sample_rate(size_t sr);
+
+                /**
+                 * Change the FFT rank, does not allocate memory. The internal state
+                 * of the crossover is cleared and the band masks are rebuilt
+                 * @param rank FFT rank, not greater than the maximum FFT rank
+                 */
+                void                set_rank(size_t rank);
+
+                /**
+                 * Set the phase of the frame relative to the frame hop, allows to distribute
+                 * the FFT load between several crossovers
+                 * @param phase phase in range of [0..1]
+                 */
+                void                set_phase(float phase);
+
+                /**
+                 * Enable or disable band
+                 * @param band band number
+                 * @param enable enable flag
+                 */
+                void                enable_band(size_t band, bool enable);
+
+                /**
+                 * Mute or unmute band. Muted band keeps it's settings but is not processed
+                 * and it's handlers are not called
+                 * @param band band number
+                 * @param mute mute flag
+                 */
+                void                mute_band(size_t band, bool mute);
+
+                /**
+                 * Set the parameters of the hi-pass filter of the band
+                 * @param band band number
+                 * @param freq cutoff frequency
+                 * @param slope slope of the filter, dB/octave, negative value
+                 * @param enabled enable flag
+                 */
+                void                set_hpf(size_t band, float freq, float slope, bool enabled);
+
+                /**
+                 * Set the parameters of the lo-pass filter of the band
+                 * @param band band number
+                 * @param freq cutoff frequency
+                 * @param slope slope of the filter, dB/octave, negative value
+                 * @param enabled enable flag
+                 */
+                void                set_lpf(size_t band, float freq, float slope, bool enabled);
+
+                /**
+                 * Set band handler for the specific channel
+                 * @param channel channel number: 0 for left, 1 for right
+                 * @param band band number
+                 * @param func handler function
+                 * @param object object to pass to the function
+                 * @param subject subject to pass to the function
+                 */
+                void                set_handler(size_t channel, size_t band, dspu::crossover_func_t func, void *object, void *subject);
+
+                /**
+                 * Set the handler which receives the spectrum of each frame before the band split,
+                 * the handler is reset by the initialization of the crossover
+                 * @param func handler function, NULL to disable the handler
+                 * @param object object to pass to the function
+                 * @param subject subject to pass to the function
+                 */
+                void                set_spectrum_handler(spectrum_func_t func, void *object, void *subject);
+
+                /**
+                 * Update masks of the bands which settings have been changed
+                 */
+                void                update_settings();
+
+                /**
+                 * Clear the internal state of the crossover
+                 */
+                void                clear();
+
+                /**
+                 * Get the frequency chart of the band
+                 * @param band band number
+                 * @param tr destination buffer to store magnitude
+                 * @param f list of frequencies
+                 * @param count number of frequencies
+                 */
+                void                freq_chart(size_t band, float *tr, const float *f, size_t count) const;
+
+                /**
+                 * Process the signal and call the band handlers
+                 * @param left left channel
+                 * @param right right channel, may be NULL for mono processing,
+                 *   handlers of the right channel are not called in this case
+                 * @param samples number of samples to process
+                 */
+                void                process(const float *left, const float *right, size_t samples);
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(dspu::IStateDumper *v) const;
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_STEREOFFTCROSSOVER_H_ */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_RMOD_WORKER_H_
+#define PRIVATE_RMOD_WORKER_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+#include <private/rmod/Semaphore.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Persistent worker thread which executes one task at a time on behalf
+         * of the audio thread. The task is handed off without locks with the pair
+         * of semaphores: one for the request and one for the completion.
+         *
+         * The thread should be started and stopped outside of the audio thread.
+         * The worker adopts the scheduling priority of the thread which submits
+         * the tasks, so it runs at the real-time priority of the audio thread.
+         * Spinning is disabled on single-CPU systems since it only steals the time
+         * from the thread being waited for.
+         */
+        class Worker
+        {
+            public:
+                typedef void (* task_t)(void *arg);
+
+            protected:
+                Semaphore               sRequest;           // Task request
+                Semaphore               sDone;              // Task completion
+                ipc::Thread            *pThread;            // Worker thread
+                task_t                  pTask;              // Current task
+                void                   *pArg;               // Argument of the current task
+                uint32_t                nSpin;              // Number of spin iterations before going to sleep
+                int                     nPolicy;            // Scheduling policy of the audio thread
+                int                     nPriority;          // Scheduling priority of the audio thread
+                bool                    bPriority;          // Scheduling parameters of the audio thread are captured
+                bool                    bApplied;           // Scheduling parameters have been applied to the worker
+                bool                    bExit;              // Exit request
+
+            protected:
+                static status_t         thread_proc(void *arg);
+                void                    run();
+                void                    capture_priority();
+                void                    apply_priority();
+
+            public:
+                explicit Worker();
+                Worker(const Worker &) = delete;
+                Worker(Worker &&) = delete;
+                ~Worker();
+
+                Worker & operator = (const Worker &) = delete;
+                Worker & operator = (Worker &&) = delete;
+
+            public:
+                /**
+                 * Start the worker thread, does nothing if the thread is already running.
+                 * Should not be called from the audio thread
+                 * @return true if the thread is running
+                 */
+                bool                    start();
+
+                /**
+                 * Stop the worker thread and wait for it's termination.
+                 * Should not be called from the audio thread
+                 */
+                void                    stop();
+
+                /**
+                 * Check that worker thread is running
+                 * @return true if worker thread is running
+                 */
+                inline bool             running() const     { return pThread != NULL; }
+
+                /**
+                 * Submit the task to the worker. The previously submitted task should be
+                 * completed (the wait() method should be called) before submitting new one.
+                 * @param task task to execute
+                 * @param arg argument to pass to the task
+                 */
+                void                    submit(task_t task, void *arg);
+
+                /**
+                 * Wait for the completion of the last submitted task
+                 */
+                void                    wait();
+        };
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_WORKER_H_ */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_CLOCK_H_
+#define PRIVATE_RMOD_CLOCK_H_
+
+#include <lsp-plug.in/common/types.h>
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif /* PLATFORM_WINDOWS */
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * Time accounting record
+         */
+        typedef struct timing_t
+        {
+            uint64_t            nTime;                  // Time accumulated during current refresh window, nanoseconds
+            uint64_t            nTotal;                 // Time accumulated since the last reset, nanoseconds
+            float               fLoad;                  // Load of the last refresh window, percents
+        } timing_t;
+
+        /**
+         * Get the value of the monotonic clock with nanosecond resolution.
+         * The call does not enter the kernel on the systems that provide vDSO,
+         * so it is cheap enough to be called several times per audio block.
+         *
+         * @return monotonic time in nanoseconds
+         */
+        inline uint64_t clock_ns()
+        {
+        #ifdef PLATFORM_WINDOWS
+            static LARGE_INTEGER freq = { 0 };
+            LARGE_INTEGER counter;
+            if (freq.QuadPart == 0)
+                QueryPerformanceFrequency(&freq);
+            QueryPerformanceCounter(&counter);
+            return uint64_t((counter.QuadPart * 1000000000.0) / freq.QuadPart);
+        #else
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return uint64_t(ts.tv_sec) * 1000000000u + uint64_t(ts.tv_nsec);
+        #endif /* PLATFORM_WINDOWS */
+        }
+
+        /**
+         * Reset time accounting record
+         * @param t time accounting record
+         */
+        inline void timing_reset(timing_t *t)
+        {
+            t->nTime        = 0;
+            t->nTotal       = 0;
+            t->fLoad        = 0.0f;
+        }
+
+        /**
+         * Account time interval
+         * @param t time accounting record
+         * @param start start of the interval obtained by clock_ns()
+         * @return end of the interval, can be used as start of the next interval
+         */
+        inline uint64_t timing_account(timing_t *t, uint64_t start)
+        {
+            const uint64_t end  = clock_ns();
+            const uint64_t dt   = end - start;
+            t->nTime           += dt;
+            t->nTotal          += dt;
+            return end;
+        }
+
+        /**
+         * Commit the time accumulated during the refresh window and compute the load
+         * @param t time accounting record
+         * @param window the duration of refresh window in nanoseconds
+         */
+        inline void timing_commit(timing_t *t, double window)
+        {
+            t->fLoad        = (window > 0.0) ? (t->nTime * 100.0) / window : 0.0f;
+            t->nTime        = 0;
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_CLOCK_H_ */
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_DSP_H_
+#define PRIVATE_RMOD_DSP_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        /**
+         * State of the set of envelope followers stored as structure of arrays,
+         * each element of array is a separate follower (lane)
+         */
+        typedef struct follower_t
+        {
+            float              *vPeak;                  // Current peak value
+            uint32_t           *vHold;                  // Current hold counter
+            const float        *vTau;                   // Release coefficient
+            const uint32_t     *vHoldMax;               // Hold time in samples
+        } follower_t;
+
+        /**
+         * Coefficients of the band mixing
+         */
+        typedef struct band_mix_t
+        {
+            float               fA;                     // Constant term of the gain
+            float               fB;                     // Envelope term of the gain
+            float               fIn;                    // Gain of the signal mixed to the input buffer
+            float               fDry;                   // Gain of the dry signal mixed to the output buffer
+            float               fWet;                   // Gain of the wet signal mixed to the output buffer
+        } band_mix_t;
+
+        /**
+         * Peak envelope follower with hold and release, applied to the set of independent lanes.
+         * For each lane and each sample the following is performed:
+         *
+         *   s      = |env[i] * gain|
+         *   if (peak > s)
+         *      s   = (hold > 0) ? peak : peak + (s - peak) * tau, hold = max(hold - 1, 0)
+         *   else
+         *      hold = hold_max
+         *   env[i] = peak = s
+         *
+         * @param env list of lane buffers, each buffer is processed in-place
+         * @param f state of followers, one element per lane
+         * @param gain gain applied to the input signal before rectification, should be non-negative
+         * @param lanes number of lanes
+         * @param samples number of samples in each lane buffer
+         */
+        extern void (* follow_envelope)(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+
+        /**
+         * Compute the gain of the band and mix the band signal to the input and output buffers
+         * in one pass. For each sample the following is performed:
+         *
+         *   g          = max(0, A + env[i] * B)
+         *   in[i]     += src[i] * In
+         *   out[i]    += src[i] * (Dry + Wet * g)
+         *
+         * @param in input buffer to mix the band signal
+         * @param out output buffer to mix the processed band signal
+         * @param src band signal
+         * @param env band envelope
+         * @param m mixing coefficients
+         * @param count number of samples to process
+         * @return minimum value of the computed gain, FLT_MAX if count is zero
+         */
+        extern float (* mix_band)(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+
+        /**
+         * Perform stereo linking of two envelopes in-place: the lower envelope is raised
+         * to the higher one proportionally to the link value. For each sample the following
+         * is performed:
+         *
+         *   m          = max(l[i], r[i])
+         *   l[i]      += (m - l[i]) * link
+         *   r[i]      += (m - r[i]) * link
+         *
+         * @param l envelope of the left channel
+         * @param r envelope of the right channel
+         * @param link stereo link value in range of [0..1]
+         * @param count number of samples to process
+         */
+        extern void (* link_envelopes)(float *l, float *r, float link, size_t count);
+
+        /**
+         * Compute the linear combination of the set of source buffers in one pass.
+         * For each sample the following is performed:
+         *
+         *   dst[i]     = src[0][i] * k[0] + src[1][i] * k[1] + ... + src[n-1][i] * k[n-1]
+         *
+         * @param dst destination buffer
+         * @param src list of source buffers
+         * @param k list of gains, one gain per source buffer
+         * @param n number of source buffers, should be positive
+         * @param count number of samples to process
+         */
+        extern void (* mix_sources)(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+
+        /**
+         * Initialize the optimized functions according to the features of the CPU.
+         * The call is idempotent and can be safely performed multiple times.
+         */
+        void init();
+
+        namespace generic
+        {
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+            void link_envelopes(float *l, float *r, float link, size_t count);
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace generic */
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_DSP_H_ */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_RMOD_XOVER_H_
+#define PRIVATE_RMOD_XOVER_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/misc/fft_crossover.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        namespace xover
+        {
+            /**
+             * Compute the magnitude of the band formed by the hi-pass and lo-pass filters.
+             * The filters have the same shape as the filters of dspu::FFTCrossover, so the
+             * complementary bands sum to unity.
+             *
+             * @param dst destination buffer to store the magnitude
+             * @param f list of frequencies
+             * @param hpf_f0 cutoff frequency of the hi-pass filter
+             * @param hpf_slope slope of the hi-pass filter, dB/octave, negative value
+             * @param hpf hi-pass filter is enabled
+             * @param lpf_f0 cutoff frequency of the lo-pass filter
+             * @param lpf_slope slope of the lo-pass filter, dB/octave, negative value
+             * @param lpf lo-pass filter is enabled
+             * @param count number of frequencies
+             */
+            inline void band_gain(float *dst, const float *f,
+                float hpf_f0, float hpf_slope, bool hpf,
+                float lpf_f0, float lpf_slope, bool lpf,
+                size_t count)
+            {
+                dsp::fill_one(dst, count);
+                if (hpf)
+                    dspu::crossover::hipass_apply(dst, f, hpf_f0, hpf_slope, count);
+                if (lpf)
+                    dspu::crossover::lopass_apply(dst, f, lpf_f0, lpf_slope, count);
+            }
+
+        } /* namespace xover */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* PRIVATE_RMOD_XOVER_H_ */
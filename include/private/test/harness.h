@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_HARNESS_H_
+#define PRIVATE_TEST_HARNESS_H_
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+
+#include <string.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Port implementation that allows to drive the plugin module without any host wrapper
+         */
+        class HarnessPort: public plug::IPort
+        {
+            protected:
+                float               fValue;                 // Current value of the port
+                void               *pBuffer;                // Buffer associated with the port
+
+            public:
+                explicit HarnessPort(const meta::port_t *meta): plug::IPort(meta)
+                {
+                    fValue      = meta->start;
+                    pBuffer     = NULL;
+                }
+
+                HarnessPort(const HarnessPort &) = delete;
+                HarnessPort(HarnessPort &&) = delete;
+                HarnessPort & operator = (const HarnessPort &) = delete;
+                HarnessPort & operator = (HarnessPort &&) = delete;
+
+            public:
+                virtual float value() override          { return fValue;        }
+                virtual void set_value(float value) override { fValue = value;  }
+                virtual void *buffer() override         { return pBuffer;       }
+
+                inline void set_buffer(void *buffer)    { pBuffer = buffer;     }
+        };
+
+        /**
+         * Simple host emulation: allocates ports and audio buffers for the plugin module
+         * described by the metadata and allows to drive it with the fixed maximum block size
+         */
+        class PluginHarness
+        {
+            protected:
+                const meta::plugin_t   *pMeta;              // Plugin metadata
+                plug::Module           *pModule;            // Plugin module
+                HarnessPort           **vPorts;             // List of ports
+                float                 **vBuffers;           // Audio buffers associated with ports
+                core::AudioBuffer     **vLinks;             // Shared memory link buffers associated with ports
+                size_t                  nPorts;             // Number of ports
+                size_t                  nBlockSize;         // Maximum block size
+                bool                    bUpdate;            // Settings need to be updated
+                uint8_t                *pData;              // Allocated data
+
+            protected:
+                static bool is_audio_io_port(const meta::port_t *p)
+                {
+                    return (meta::is_audio_in_port(p)) || (meta::is_audio_out_port(p));
+                }
+
+            public:
+                PluginHarness()
+                {
+                    pMeta       = NULL;
+                    pModule     = NULL;
+                    vPorts      = NULL;
+                    vBuffers    = NULL;
+                    vLinks      = NULL;
+                    nPorts      = 0;
+                    nBlockSize  = 0;
+                    bUpdate     = true;
+                    pData       = NULL;
+                }
+
+                PluginHarness(const PluginHarness &) = delete;
+                PluginHarness(PluginHarness &&) = delete;
+                PluginHarness & operator = (const PluginHarness &) = delete;
+                PluginHarness & operator = (PluginHarness &&) = delete;
+
+                ~PluginHarness()
+                {
+                    destroy();
+                }
+
+            public:
+                /**
+                 * Initialize the harness
+                 * @param module plugin module to drive, the harness takes ownership
+                 * @param sample_rate sample rate
+                 * @param block_size maximum block size passed to the process() call
+                 * @return true on success
+                 */
+                bool init(plug::Module *module, long sample_rate, size_t block_size)
+                {
+                    destroy();
+
+                    pModule         = module;
+                    pMeta           = module->metadata();
+                    nBlockSize      = block_size;
+
+                    // Count number of ports
+                    nPorts          = 0;
+                    for (const meta::port_t *p = pMeta->ports; p->id != NULL; ++p)
+                        ++nPorts;
+
+                    // Allocate memory
+                    size_t szof_ports   = align_size(sizeof(HarnessPort *) * nPorts, OPTIMAL_ALIGN);
+                    size_t szof_bufs    = align_size(sizeof(float *) * nPorts, OPTIMAL_ALIGN);
+                    size_t szof_buf     = align_size(sizeof(float) * block_size, OPTIMAL_ALIGN);
+                    size_t szof_links   = align_size(sizeof(core::AudioBuffer *) * nPorts, OPTIMAL_ALIGN);
+                    size_t audio_ports  = 0;
+                    for (const meta::port_t *p = pMeta->ports; p->id != NULL; ++p)
+                        if (is_audio_io_port(p))
+                            ++audio_ports;
+
+                    uint8_t *ptr        = alloc_aligned<uint8_t>(pData, szof_ports + szof_bufs + szof_links + szof_buf * audio_ports, OPTIMAL_ALIGN);
+                    if (ptr == NULL)
+                        return false;
+
+                    vPorts              = advance_ptr_bytes<HarnessPort *>(ptr, szof_ports);
+                    vBuffers            = advance_ptr_bytes<float *>(ptr, szof_bufs);
+                    vLinks              = advance_ptr_bytes<core::AudioBuffer *>(ptr, szof_links);
+
+                    // Create ports
+                    for (size_t i=0; i<nPorts; ++i)
+                    {
+                        const meta::port_t *p   = &pMeta->ports[i];
+                        HarnessPort *port       = new HarnessPort(p);
+                        vPorts[i]               = port;
+                        vBuffers[i]             = NULL;
+                        vLinks[i]               = NULL;
+
+                        if (p->role == meta::R_AUDIO_RETURN)
+                        {
+                            // Shared memory link is inactive until it is explicitly enabled
+                            core::AudioBuffer *buf  = new core::AudioBuffer();
+                            buf->set_size(block_size);
+                            buf->set_active(false);
+                            vLinks[i]               = buf;
+                            port->set_buffer(buf);
+                        }
+                        else if (is_audio_io_port(p))
+                        {
+                            vBuffers[i]             = advance_ptr_bytes<float>(ptr, szof_buf);
+                            dsp::fill_zero(vBuffers[i], block_size);
+                            port->set_buffer(vBuffers[i]);
+                        }
+                    }
+
+                    // Initialize plugin
+                    pModule->init(NULL, reinterpret_cast<plug::IPort **>(vPorts));
+                    pModule->set_sample_rate(sample_rate);
+                    pModule->activate();
+                    bUpdate         = true;
+
+                    return true;
+                }
+
+                void destroy()
+                {
+                    if (pModule != NULL)
+                    {
+                        pModule->deactivate();
+                        pModule->destroy();
+                        delete pModule;
+                        pModule     = NULL;
+                    }
+
+                    if (vPorts != NULL)
+                    {
+                        for (size_t i=0; i<nPorts; ++i)
+                        {
+                            if (vPorts[i] != NULL)
+                                delete vPorts[i];
+                            if (vLinks[i] != NULL)
+                                delete vLinks[i];
+                        }
+                        vPorts      = NULL;
+                    }
+
+                    vBuffers    = NULL;
+                    vLinks      = NULL;
+                    nPorts      = 0;
+
+                    if (pData != NULL)
+                    {
+                        free_aligned(pData);
+                        pData       = NULL;
+                    }
+                }
+
+            public:
+                inline plug::Module *module()       { return pModule;       }
+                inline size_t block_size() const    { return nBlockSize;    }
+
+                /**
+                 * Find port by identifier
+                 * @param id port identifier
+                 * @return port index or negative value if not found
+                 */
+                ssize_t index_of(const char *id) const
+                {
+                    for (size_t i=0; i<nPorts; ++i)
+                        if (!strcmp(pMeta->ports[i].id, id))
+                            return i;
+                    return -1;
+                }
+
+                /**
+                 * Set value of the control port
+                 * @param id port identifier
+                 * @param value value to set
+                 * @return true if port has been found
+                 */
+                bool set(const char *id, float value)
+                {
+                    const ssize_t index = index_of(id);
+                    if (index < 0)
+                        return false;
+
+                    vPorts[index]->set_value(value);
+                    bUpdate         = true;
+                    return true;
+                }
+
+                /**
+                 * Get the port
+                 * @param id port identifier
+                 * @return port or NULL if not found
+                 */
+                plug::IPort *port(const char *id)
+                {
+                    const ssize_t index = index_of(id);
+                    return (index >= 0) ? vPorts[index] : NULL;
+                }
+
+                /**
+                 * Get value of the port
+                 * @param id port identifier
+                 * @return value of the port
+                 */
+                float get(const char *id) const
+                {
+                    const ssize_t index = index_of(id);
+                    return (index >= 0) ? vPorts[index]->value() : 0.0f;
+                }
+
+                /**
+                 * Get audio buffer associated with the port
+                 * @param id port identifier
+                 * @return pointer to audio buffer or NULL
+                 */
+                float *buffer(const char *id)
+                {
+                    const ssize_t index = index_of(id);
+                    return (index >= 0) ? vBuffers[index] : NULL;
+                }
+
+                /**
+                 * Get shared memory link buffer
+                 * @param index the index of the shared memory link port (channel)
+                 * @return shared memory link buffer or NULL
+                 */
+                core::AudioBuffer *link(size_t index)
+                {
+                    for (size_t i=0; i<nPorts; ++i)
+                    {
+                        if (vLinks[i] == NULL)
+                            continue;
+                        if ((index--) == 0)
+                            return vLinks[i];
+                    }
+                    return NULL;
+                }
+
+                /**
+                 * Force the update_settings() call before the next processing
+                 */
+                inline void update()                { bUpdate = true;       }
+
+                /**
+                 * Process the block of audio data stored in audio buffers
+                 * @param samples number of samples to process, should not exceed block size
+                 */
+                void process(size_t samples)
+                {
+                    if (bUpdate)
+                    {
+                        pModule->update_settings();
+                        bUpdate         = false;
+                    }
+                    pModule->process(samples);
+                }
+        };
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_HARNESS_H_ */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_RENDER_H_
+#define PRIVATE_TEST_RENDER_H_
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/runtime/system.h>
+
+#include <private/test/harness.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        inline double time_seconds()
+        {
+            system::time_t ts;
+            system::get_time(&ts);
+            return double(ts.seconds) + double(ts.nanos) * 1e-9;
+        }
+
+        inline char *trim(char *s)
+        {
+            while ((*s == ' ') || (*s == '\t'))
+                ++s;
+
+            char *end = s + strlen(s);
+            while ((end > s) && ((end[-1] == ' ') || (end[-1] == '\t') || (end[-1] == '\n') || (end[-1] == '\r')))
+                --end;
+            *end = '\0';
+
+            return s;
+        }
+
+        /**
+         * Parse value in the format of configuration file: booleans, plain numbers
+         * and numbers with 'db' suffix
+         */
+        inline bool parse_value(float *dst, char *text)
+        {
+            text        = trim(text);
+            if (text[0] == '\"')
+                return false; // String value, skip it
+
+            if (!strcmp(text, "true"))
+            {
+                *dst        = 1.0f;
+                return true;
+            }
+            if (!strcmp(text, "false"))
+            {
+                *dst        = 0.0f;
+                return true;
+            }
+
+            char *end   = NULL;
+            float value = strtof(text, &end);
+            if (end == text)
+                return false;
+
+            end         = trim(end);
+            if (!strcmp(end, "db"))
+                value       = dspu::db_to_gain(value);
+            else if (end[0] != '\0')
+                return false;
+
+            *dst        = value;
+            return true;
+        }
+
+        /**
+         * Apply 'id = value' assignment
+         */
+        inline bool apply_assignment(PluginHarness &h, char *line)
+        {
+            char *eq = strchr(line, '=');
+            if (eq == NULL)
+                return false;
+            *eq         = '\0';
+
+            float value;
+            const char *id  = trim(line);
+            if (!parse_value(&value, eq + 1))
+                return true;
+
+            return h.set(id, value);
+        }
+
+        /**
+         * Load plugin configuration file, unknown parameters are reported and ignored
+         */
+        inline bool load_config(PluginHarness &h, const char *path)
+        {
+            FILE *fd = fopen(path, "r");
+            if (fd == NULL)
+                return false;
+            lsp_finally { fclose(fd); };
+
+            char buf[1024];
+            while (fgets(buf, sizeof(buf), fd) != NULL)
+            {
+                char *line = trim(buf);
+                if ((line[0] == '\0') || (line[0] == '#'))
+                    continue;
+                if (!apply_assignment(h, line))
+                    fprintf(stderr, "Ignoring unknown parameter: %s\n", line);
+            }
+
+            return true;
+        }
+
+        /**
+         * Copy the block of data from the file to the buffer or fill the buffer with zeros
+         * if there is no more data
+         */
+        inline void read_block(float *dst, const dspu::Sample *s, size_t channel, size_t offset, size_t count)
+        {
+            if ((s == NULL) || (s->channels() <= 0))
+            {
+                dsp::fill_zero(dst, count);
+                return;
+            }
+
+            const float *src    = s->channel(channel % s->channels());
+            const size_t avail  = (offset < s->length()) ? lsp_min(s->length() - offset, count) : 0;
+            if (avail > 0)
+                dsp::copy(dst, &src[offset], avail);
+            if (avail < count)
+                dsp::fill_zero(&dst[avail], count - avail);
+        }
+
+        /**
+         * Render the input streams with the configured plugin
+         * @param out output sample, latency-compensated, has the same length as the input
+         * @param latency the latency reported by the plugin
+         * @param time time spent in process() calls, may be NULL
+         * @param h plugin harness
+         * @param in input stream
+         * @param sc sidechain stream, may be NULL
+         * @param link shared memory link stream, may be NULL to keep the link inactive
+         * @return true on success
+         */
+        inline bool render(dspu::Sample *out, size_t *latency, double *time, PluginHarness &h,
+            const dspu::Sample *in, const dspu::Sample *sc, const dspu::Sample *link)
+        {
+            static const char *in_ids[]     = { "in_l", "in_r" };
+            static const char *sc_ids[]     = { "sc_l", "sc_r" };
+            static const char *out_ids[]    = { "out_l", "out_r" };
+
+            // Bind buffers
+            const size_t channels       = (in->channels() > 1) ? 2 : 1;
+            float *vin[2], *vsc[2], *vout[2];
+            core::AudioBuffer *vlink[2];
+            for (size_t i=0; i<channels; ++i)
+            {
+                vin[i]      = h.buffer((channels > 1) ? in_ids[i] : "in");
+                vsc[i]      = h.buffer((channels > 1) ? sc_ids[i] : "sc");
+                vout[i]     = h.buffer((channels > 1) ? out_ids[i] : "out");
+                vlink[i]    = h.link(i);
+
+                if ((vin[i] == NULL) || (vsc[i] == NULL) || (vout[i] == NULL))
+                    return false;
+                if (vlink[i] != NULL)
+                    vlink[i]->set_active(link != NULL);
+            }
+
+            // Compute the amount of output data: add the reported latency to keep the tail
+            h.process(0);
+            *latency                    = h.module()->latency();
+            const size_t length         = in->length() + *latency;
+
+            if (!out->init(channels, length, length))
+                return false;
+            out->set_sample_rate(in->sample_rate());
+
+            // Perform the rendering
+            double spent                = 0.0;
+            for (size_t offset=0; offset < length; )
+            {
+                const size_t to_do = lsp_min(length - offset, h.block_size());
+
+                for (size_t i=0; i<channels; ++i)
+                {
+                    read_block(vin[i], in, i, offset, to_do);
+                    read_block(vsc[i], sc, i, offset, to_do);
+                    if ((vlink[i] != NULL) && (link != NULL))
+                        read_block(vlink[i]->buffer(), link, i, offset, to_do);
+                }
+
+                const double start = time_seconds();
+                h.process(to_do);
+                spent          += time_seconds() - start;
+
+                for (size_t i=0; i<channels; ++i)
+                    dsp::copy(&out->channel(i)[offset], vout[i], to_do);
+
+                offset         += to_do;
+            }
+            if (time != NULL)
+                *time           = spent;
+
+            // Remove latency
+            for (size_t i=0; i<channels; ++i)
+                dsp::move(out->channel(i), &out->channel(i)[*latency], in->length());
+            out->set_length(in->length());
+
+            return true;
+        }
+
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_RENDER_H_ */
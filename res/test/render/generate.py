@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+#
+# Generates the deterministic input files for the 'render' unit test:
+# 2 seconds of 16-bit audio at 48 kHz, the noise is produced by the fixed-seed LCG.
+# Run from this directory, the output does not depend on the platform.
+#
+
+import math, struct, wave
+
+SR      = 48000
+LENGTH  = SR * 2
+
+class Lcg:
+    def __init__(self, seed):
+        self.state = seed & 0xffffffff
+    def next(self):
+        self.state = (self.state * 1664525 + 1013904223) & 0xffffffff
+        return self.state / 2147483648.0 - 1.0
+
+def noise(seed, amp):
+    g = Lcg(seed)
+    return [amp * g.next() for i in range(LENGTH)]
+
+def sweep(f0, f1, amp):
+    t   = LENGTH / SR
+    k   = math.log(f1 / f0)
+    return [amp * math.sin(2.0 * math.pi * f0 * t / k * (math.exp(k * i / LENGTH) - 1.0)) for i in range(LENGTH)]
+
+def tone(f, amp):
+    return [amp * math.sin(2.0 * math.pi * f * i / SR) for i in range(LENGTH)]
+
+def gate(x, on, period):
+    return [v if (i % period) < on else 0.0 for i, v in enumerate(x)]
+
+def modulate(x, f):
+    return [v * 0.5 * (1.0 - math.cos(2.0 * math.pi * f * i / SR)) for i, v in enumerate(x)]
+
+def mix(a, b):
+    return [x + y for x, y in zip(a, b)]
+
+def save(name, channels):
+    with wave.open(name, 'wb') as w:
+        w.setnchannels(len(channels))
+        w.setsampwidth(2)
+        w.setframerate(SR)
+        data = bytearray()
+        for i in range(LENGTH):
+            for c in channels:
+                v = max(-32767, min(32767, int(round(c[i] * 32767.0))))
+                data += struct.pack('<h', v)
+        w.writeframes(bytes(data))
+
+save('in_mono.wav', [mix(noise(1, 0.25), tone(220.0, 0.25))])
+save('in_stereo.wav', [sweep(20.0, 20000.0, 0.5), mix(noise(2, 0.25), tone(330.0, 0.25))])
+save('sc_mono.wav', [gate(noise(3, 0.5), SR // 20, SR // 10)])
+save('sc_stereo.wav', [gate(noise(4, 0.5), SR // 20, SR // 8), modulate(sweep(20000.0, 20.0, 0.5), 4.0)])
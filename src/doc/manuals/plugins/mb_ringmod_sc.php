@@ -29,8 +29,17 @@ effect, additional smoothing, prediction and reactivity controls were added.</p>
 	<ul>
 		<li><b>Classic</b> - classic operating mode using IIR filters and allpass filters to compensate phase shifts.</li>
 		<li><b>Linear Phase</b> - linear phase operating mode using FFT transform (FIR filters) to split signal into multiple bands, introduces additional latency.</li>
+		<li><b>Low Latency</b> - linear phase operating mode using partitioned convolution with FIR filters, the latency is equal to the half of the filter length plus the partition size.</li>
 	</ul>
 	<li><b>Slope</b> - the slope of crossover filters.</li>
+	<li><b>Partition</b> - the partition size in samples for the <b>Low Latency</b> mode, smaller partitions give lower latency at the cost of higher CPU load.</li>
+	<li><b>Resolution</b> - the frequency resolution of the linear phase crossover filters, affects the latency, CPU load and memory consumption:</li>
+	<ul>
+		<li><b>Auto</b> - the resolution is selected automatically to be enough for the lowest enabled split frequency.</li>
+		<li><b>Low</b> - half of the normal resolution.</li>
+		<li><b>Normal</b> - the resolution depends on the sample rate only.</li>
+		<li><b>High</b> - twice the normal resolution.</li>
+	</ul>
 	<li><b>Type</b> - The sidechain source type:</li>
 	<ul>
 		<li><b>Internal</b> - the input signal is taken as a sidechain after pre-mixing stage.</li>
@@ -52,6 +61,14 @@ effect, additional smoothing, prediction and reactivity controls were added.</p>
 		<li><b>Max</b> both the left and right channels are processed using the maximum signal between left and right channels of sidechain.</li>
 	</ul>
 	<?php } ?>
+	<li><b>Threading</b> - the multi-threaded processing mode:</li>
+	<ul>
+		<li><b>Off</b> - all processing is performed by the audio thread.</li>
+		<?php if ($m == 's') { ?>
+		<li><b>Parallel</b> - the right channel is processed by the additional worker thread simultaneously with the left channel, reduces the processing time of the audio block on multi-core systems. In linear phase modes the crossover processes both channels at once, so only the band processing is split between threads.</li>
+		<?php } ?>
+		<li><b>Pipeline</b> - the sidechain is processed by the additional worker thread simultaneously with the input signal, the input signal is processed using the sidechain envelope of the previous audio block. The look-ahead time is reduced by the block size of 512 samples, additional latency is introduced only if the look-ahead is less than the block size.</li>
+	</ul>
 	<li><b>Pre-mix</b> - shows pre-mix control overlay.</li>
 	<li><b>Mix</b> - shows the Dry/Wet control overlay.</li>
 	<li><b>Link</b> - the name of the shared memory link to pass sidechain signal.</li>
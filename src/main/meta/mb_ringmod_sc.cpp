@@ -25,7 +25,7 @@
 
 #define LSP_PLUGINS_MB_RINGMOD_SC_VERSION_MAJOR         1
 #define LSP_PLUGINS_MB_RINGMOD_SC_VERSION_MINOR         0
-#define LSP_PLUGINS_MB_RINGMOD_SC_VERSION_MICRO         0
+#define LSP_PLUGINS_MB_RINGMOD_SC_VERSION_MICRO         1
 
 #define LSP_PLUGINS_MB_RINGMOD_SC_VERSION  \
     LSP_MODULE_VERSION( \
@@ -65,6 +65,42 @@ namespace lsp
         {
             { "Classic",        "multiband.classic"         },
             { "Linear Phase",   "multiband.linear_phase"    },
+            { "Low Latency",    "mb_ringmod.modes.low_latency" },
+            { NULL, NULL }
+        };
+
+        static const port_item_t mb_ringmod_sc_resolutions[] =
+        {
+            { "Auto",           "mb_ringmod.resolution.auto"    },
+            { "Low",            "mb_ringmod.resolution.low"     },
+            { "Normal",         "mb_ringmod.resolution.normal"  },
+            { "High",           "mb_ringmod.resolution.high"    },
+            { NULL, NULL }
+        };
+
+        static const port_item_t mb_ringmod_sc_threading_mono[] =
+        {
+            { "Off",            "mb_ringmod.threading.off"      },
+            { "Pipeline",       "mb_ringmod.threading.pipeline" },
+            { NULL, NULL }
+        };
+
+        static const port_item_t mb_ringmod_sc_threading_stereo[] =
+        {
+            { "Off",            "mb_ringmod.threading.off"      },
+            { "Parallel",       "mb_ringmod.threading.parallel" },
+            { "Pipeline",       "mb_ringmod.threading.pipeline" },
+            { NULL, NULL }
+        };
+
+        static const port_item_t mb_ringmod_sc_partitions[] =
+        {
+            { "64",             NULL                        },
+            { "128",            NULL                        },
+            { "256",            NULL                        },
+            { "512",            NULL                        },
+            { "1024",           NULL                        },
+            { "2048",           NULL                        },
             { NULL, NULL }
         };
 
@@ -89,6 +125,8 @@ namespace lsp
         COMBO("type", "Sidechain type", "Type", 1, ringmod_sc_types), \
         COMBO("mode", "Crossover mode", "Mode", 0, mb_ringmod_sc_modes), \
         COMBO("slope", "Crossover slope", "Slope", 2, mb_ringmod_sc_slopes), \
+        COMBO("part", "Low latency partition size", "Partition", mb_ringmod_sc::FIR_PART_DFL, mb_ringmod_sc_partitions), \
+        COMBO("res", "Linear phase crossover resolution", "Resolution", mb_ringmod_sc::FFT_XOVER_RES_DFL, mb_ringmod_sc_resolutions), \
         SWITCH("showmx", "Show mix overlay", "Show mix bar", 0.0f), \
         AMP_GAIN10("dry", "Dry gain", "Dry", GAIN_AMP_M_INF_DB), \
         AMP_GAIN10("wet", "Wet gain", "Wet", GAIN_AMP_0_DB), \
@@ -98,7 +136,8 @@ namespace lsp
         LOG_CONTROL("react", "FFT reactivity", "Reactivity", U_MSEC, mb_ringmod_sc::REACT_TIME), \
         AMP_GAIN100("shift", "Shift gain", "Shift", 1.0f), \
         MESH("bfc", "Band filter charts", 9, mb_ringmod_sc::FFT_MESH_POINTS + 4), \
-        MESH("meters", "Band filter reduction meters", 1 + channels * 4, mb_ringmod_sc::FFT_MESH_POINTS + 4)
+        MESH("meters", "Band filter reduction meters", 1 + channels * 4, mb_ringmod_sc::FFT_MESH_POINTS + 4), \
+        METER("dload", "DSP load", U_PERCENT, mb_ringmod_sc::DSP_LOAD)
 
     #define RMOD_METER_BUTTONS(id, label, alias) \
         SWITCH("ifft" id, "Input FFT analysis" label, "FFT In" alias, 1), \
@@ -109,11 +148,13 @@ namespace lsp
         METER_GAIN("olm" id, "Output level meter" label, GAIN_AMP_P_24_DB)
 
     #define RMOD_COMMON_MONO \
-        RMOD_COMMON(1)
+        RMOD_COMMON(1), \
+        COMBO("mt", "Multi-threaded processing", "Threading", 0, mb_ringmod_sc_threading_mono)
 
     #define RMOD_COMMON_STEREO \
         RMOD_COMMON(2), \
-        COMBO("source", "Sidechain source", "Source", 0, ringmod_sc_sources)
+        COMBO("source", "Sidechain source", "Source", 0, ringmod_sc_sources), \
+        COMBO("mt", "Multi-threaded processing", "Threading", 0, mb_ringmod_sc_threading_stereo)
 
     #define RMOD_MIX_SIGNAL \
         SWITCH("showmx", "Show mix overlay", "Show mix bar", 0.0f), \
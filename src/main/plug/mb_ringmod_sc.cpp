@@ -32,6 +32,8 @@
 #include <lsp-plug.in/shared/id_colors.h>
 
 #include <private/plugins/mb_ringmod_sc.h>
+#include <private/rmod/DenormalGuard.h>
+#include <private/rmod/dsp.h>
 
 namespace lsp
 {
@@ -39,6 +41,37 @@ namespace lsp
     {
         /* The size of temporary buffer for audio processing */
         static constexpr size_t BUFFER_SIZE         = 0x200;
+        /* The maximum number of envelope followers processed at once */
+        static constexpr size_t FOLLOWERS_MAX       = meta::mb_ringmod_sc::BANDS_MAX * 2;
+        /* The time of continuous silence on inputs before entering the idle state, ms */
+        static constexpr float IDLE_HOLD_TIME       = 1000.0f;
+        /* The envelope level below which the band is considered as silent (-120 dB) */
+        static constexpr float IDLE_THRESHOLD       = 1e-6f;
+        /* The envelope level below which the release tail is snapped to zero (-200 dB) */
+        static constexpr float ENV_FLOOR            = 1e-10f;
+        /* The size of L1 data cache the working set of the processing slice should fit into */
+        static constexpr size_t L1_CACHE_SIZE       = 0x8000;
+        /* The minimum size of the processing slice */
+        static constexpr size_t SLICE_SIZE_MIN      = 0x40;
+        /* The number of per-channel buffers touched by each slice: premix, data and sidechain buffers */
+        static constexpr size_t SLICE_CH_BUFFERS    = 6;
+        /* The number of per-band buffers touched by each slice: envelope and band data */
+        static constexpr size_t SLICE_BAND_BUFFERS  = 2;
+
+        /* The sidechain signal of each channel as a combination of channels for each sidechain source */
+        static const float sc_source_matrix[][2][2] =
+        {
+            { { 1.0f,  0.0f }, { 0.0f,  1.0f } },   // SC_SRC_LEFT_RIGHT
+            { { 0.0f,  1.0f }, { 1.0f,  0.0f } },   // SC_SRC_RIGHT_LEFT
+            { { 1.0f,  0.0f }, { 1.0f,  0.0f } },   // SC_SRC_LEFT
+            { { 0.0f,  1.0f }, { 0.0f,  1.0f } },   // SC_SRC_RIGHT
+            { { 0.5f,  0.5f }, { 0.5f, -0.5f } },   // SC_SRC_MID_SIDE
+            { { 0.5f, -0.5f }, { 0.5f,  0.5f } },   // SC_SRC_SIDE_MID
+            { { 0.5f,  0.5f }, { 0.5f,  0.5f } },   // SC_SRC_MIDDLE
+            { { 0.5f, -0.5f }, { 0.5f, -0.5f } },   // SC_SRC_SIDE
+            { { 1.0f,  0.0f }, { 0.0f,  1.0f } },   // SC_SRC_MIN, followed by the absolute minimum
+            { { 1.0f,  0.0f }, { 0.0f,  1.0f } },   // SC_SRC_MAX, followed by the absolute maximum
+        };
 
         //---------------------------------------------------------------------
         // Plugin factory
@@ -55,10 +88,70 @@ namespace lsp
 
         static plug::Factory factory(plugin_factory, plugins, 2);
 
+        static inline float premix_gain(float gain)
+        {
+            return (gain > GAIN_AMP_M_INF_DB) ? gain : 0.0f;
+        }
+
+        static void dump_timing(dspu::IStateDumper *v, const char *name, const rmod::timing_t *t)
+        {
+            if (name != NULL)
+                v->begin_object(name, t, sizeof(rmod::timing_t));
+            else
+                v->begin_object(t, sizeof(rmod::timing_t));
+            {
+                v->write("nTime", t->nTime);
+                v->write("nTotal", t->nTotal);
+                v->write("fLoad", t->fLoad);
+            }
+            v->end_object();
+        }
+
+        //---------------------------------------------------------------------
+        // Thread control
+        mb_ringmod_sc::ThreadControl::ThreadControl(rmod::Worker *worker, rmod::AsyncAnalyzer *analyzer)
+        {
+            pWorker         = worker;
+            pAnalyzer       = analyzer;
+            bWorker         = false;
+            bAnalyzer       = false;
+        }
+
+        mb_ringmod_sc::ThreadControl::~ThreadControl()
+        {
+            pWorker         = NULL;
+            pAnalyzer       = NULL;
+        }
+
+        void mb_ringmod_sc::ThreadControl::request(bool worker, bool analyzer)
+        {
+            bWorker         = worker;
+            bAnalyzer       = analyzer;
+        }
+
+        status_t mb_ringmod_sc::ThreadControl::run()
+        {
+            if (!bWorker)
+                pWorker->stop();
+            else if (!pWorker->start())
+            {
+                lsp_warn("Failed to start worker thread, multi-threaded processing is not available");
+                bWorker         = false;
+            }
+            if ((bAnalyzer) && (!pAnalyzer->start()))
+            {
+                lsp_warn("Failed to start analyzer thread, spectrum analysis is not available");
+                bAnalyzer       = false;
+            }
+
+            return STATUS_OK;
+        }
+
         //---------------------------------------------------------------------
         // Implementation
         mb_ringmod_sc::mb_ringmod_sc(const meta::plugin_t *meta):
-            Module(meta)
+            Module(meta),
+            sThreadControl(&sWorker, &sAnalyzer)
         {
             // Compute the number of audio channels by the number of inputs
             nChannels       = 0;
@@ -71,7 +164,15 @@ namespace lsp
             vBuffer             = NULL;
             vEmptyBuffer        = NULL;
             vFreqs              = NULL;
-            vIndexes            = NULL;
+
+            for (size_t i=0; i<STG_TOTAL; ++i)
+                rmod::timing_reset(&vTiming[i]);
+            rmod::timing_reset(&sTiming);
+            nTimingSamples      = 0;
+            nIdleSamples        = 0;
+            nIdleDelay          = 0;
+            nSliceSize          = BUFFER_SIZE;
+            nSliceHint          = 0;
 
             // Pre-mixing ports
             sPremix.fInToSc     = GAIN_AMP_M_INF_DB;
@@ -88,10 +189,23 @@ namespace lsp
             sPremix.pScToIn     = NULL;
             sPremix.pScToLink   = NULL;
 
+            for (size_t i=0; i<2; ++i)
+                for (size_t j=0; j<2; ++j)
+                    for (size_t k=0; k<MIX_TOTAL; ++k)
+                    {
+                        sPremix.vInMix[i].vGain[j][k]   = 0.0f;
+                        sPremix.vScMix[i].vGain[j][k]   = 0.0f;
+                    }
+            sPremix.nScPost     = MIX_POST_NONE;
+            sPremix.bScShared   = false;
+
             nType               = SC_TYPE_EXTERNAL;
             nSource             = SC_SRC_LEFT_RIGHT;
             nMode               = MODE_IIR;
+            nSlope              = 0;
+            nPartRank           = meta::mb_ringmod_sc::FIR_PART_RANK_MIN + meta::mb_ringmod_sc::FIR_PART_DFL;
             nLatency            = 0;
+            nThreading          = MT_OFF;
             fInGain             = GAIN_AMP_0_DB;
             fScGain             = GAIN_AMP_0_DB;
             fDryGain            = GAIN_AMP_M_INF_DB;
@@ -105,6 +219,12 @@ namespace lsp
             bInvert             = false;
             bOutIn              = true;
             bOutSc              = true;
+            bScMono             = false;
+            bIdle               = false;
+            bWorker             = false;
+            bAnalyzer           = false;
+            bUiActive           = false;
+            bDisplayDrawn       = true;
 
             pIDisplay           = NULL;
 
@@ -119,6 +239,8 @@ namespace lsp
             pType               = NULL;
             pMode               = NULL;
             pSlope              = NULL;
+            pPartition          = NULL;
+            pResolution         = NULL;
             pDry                = NULL;
             pWet                = NULL;
             pDryWet             = NULL;
@@ -127,7 +249,13 @@ namespace lsp
             pShift              = NULL;
             pFilterMesh         = NULL;
             pMeterMesh          = NULL;
+            pDspLoad            = NULL;
             pSource             = NULL;
+            pThreading          = NULL;
+
+            sTask.pSelf         = this;
+            sTask.pChannel      = NULL;
+            sTask.nSamples      = 0;
 
             // Bind split ports
             for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX-1; ++i)
@@ -148,6 +276,7 @@ namespace lsp
                 b->fFreqStart       = 0.0f;
                 b->fFreqEnd         = 0.0f;
                 b->fTauRelease      = 0.0f;
+                b->fRelease         = -1.0f;
                 b->fAmount          = GAIN_AMP_0_DB;
                 b->nHold            = 0;
                 b->nLatency         = 0;
@@ -157,6 +286,7 @@ namespace lsp
                 b->bActive          = false;
                 b->bOn              = false;
                 b->bMute            = false;
+                b->bUpdChart        = true;
 
                 b->pSolo            = NULL;
                 b->pMute            = NULL;
@@ -183,28 +313,30 @@ namespace lsp
             // Call parent class for initialization
             Module::init(wrapper, ports);
 
+            // Initialize optimized functions
+            rmod::init();
+
             // Estimate the number of bytes to allocate
             size_t szof_channels    = align_size(sizeof(channel_t) * nChannels, OPTIMAL_ALIGN);
             size_t szof_buf         = BUFFER_SIZE * sizeof(float);
             size_t szof_fft         = meta::mb_ringmod_sc::FFT_MESH_POINTS * sizeof(float);
-            size_t szof_ifft        = meta::mb_ringmod_sc::FFT_MESH_POINTS * sizeof(uint32_t);
             size_t szof_tmp         = lsp_max(szof_buf, szof_fft * 2);
             size_t alloc            = szof_channels + // v_channels
                                       szof_tmp + // vBuffer
                                       szof_buf + // vEmptyBuffer
                                       szof_fft + // vFreqs
-                                      szof_ifft + // vIndices
                                       meta::mb_ringmod_sc::BANDS_MAX * ( // band_t
                                           szof_fft // vTr
                                       ) +
                                       nChannels * ( // channel_t::
-                                          szof_buf * 3 + // vTmpIn, vTmpLink, vTmpSc
+                                          szof_buf * 2 + // vTmpIn, vTmpSc
                                           szof_buf + // vDataIn
                                           szof_buf + // vSidechain
                                           szof_buf + // vDataOut
                                           szof_fft * 3 + // vGain, vFftIn, vFftOut
                                           meta::mb_ringmod_sc::BANDS_MAX * ( // ch_band_t::
-                                              szof_buf // vEnvelope
+                                              szof_buf + // vEnvelope
+                                              szof_buf // vBandData
                                           )
                                       );
 
@@ -218,17 +350,21 @@ namespace lsp
             vBuffer                 = advance_ptr_bytes<float>(ptr, szof_tmp);
             vEmptyBuffer            = advance_ptr_bytes<float>(ptr, szof_buf);
             vFreqs                  = advance_ptr_bytes<float>(ptr, szof_fft);
-            vIndexes                = advance_ptr_bytes<uint32_t>(ptr, szof_ifft);
 
             // Initialize analyzer
             if (!sAnalyzer.init(nChannels * MTR_TOTAL, meta::mb_ringmod_sc::FFT_RANK,
-                MAX_SAMPLE_RATE, meta::mb_ringmod_sc::REFRESH_RATE))
+                MAX_SAMPLE_RATE, meta::mb_ringmod_sc::REFRESH_RATE,
+                meta::mb_ringmod_sc::FFT_MESH_POINTS, SPEC_FREQ_MIN, SPEC_FREQ_MAX))
                 return;
-            sAnalyzer.set_rank(meta::mb_ringmod_sc::FFT_RANK);
-            sAnalyzer.set_activity(false);
             sAnalyzer.set_envelope(dspu::envelope::WHITE_NOISE);
             sAnalyzer.set_window(meta::mb_ringmod_sc::FFT_WINDOW);
-            sAnalyzer.set_rate(meta::mb_ringmod_sc::REFRESH_RATE);
+            sAnalyzer.get_frequencies(vFreqs);
+
+            // Initialize spectrum taps of the FFT crossovers
+            if (!sInTap.init(vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS))
+                return;
+            if (!sScTap.init(vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS))
+                return;
 
             sCounter.set_frequency(meta::mb_ringmod_sc::REFRESH_RATE, true);
 
@@ -248,8 +384,6 @@ namespace lsp
                 c->sDryDelay.construct();
                 c->sCrossover.construct();
                 c->sScCrossover.construct();
-                c->sFFTCrossover.construct();
-                c->sFFTScCrossover.construct();
 
                 if (!c->sCrossover.init(meta::mb_ringmod_sc::BANDS_MAX, BUFFER_SIZE))
                     return;
@@ -261,11 +395,15 @@ namespace lsp
                     ch_band_t *cb   = &c->vBands[j];
 
                     cb->sEnvDelay.construct();
+                    cb->sEnvMax.construct();
 
                     cb->nHold               = 0;
                     cb->fPeak               = GAIN_AMP_M_INF_DB;
+                    rmod::timing_reset(&cb->sScTiming);
+                    rmod::timing_reset(&cb->sTiming);
 
                     cb->vEnvelope           = advance_ptr_bytes<float>(ptr, szof_buf);
+                    cb->vBandData           = advance_ptr_bytes<float>(ptr, szof_buf);
 
                     cb->pReduction          = NULL;
                 }
@@ -278,9 +416,9 @@ namespace lsp
                 c->vInPtr               = NULL;
                 c->vScPtr               = NULL;
                 c->vOutPtr              = NULL;
+                c->vInDelayPtr          = NULL;
 
                 c->vTmpIn               = advance_ptr_bytes<float>(ptr, szof_buf);
-                c->vTmpLink             = advance_ptr_bytes<float>(ptr, szof_buf);
                 c->vTmpSc               = advance_ptr_bytes<float>(ptr, szof_buf);
 
                 c->vDataIn              = advance_ptr_bytes<float>(ptr, szof_buf);
@@ -295,6 +433,7 @@ namespace lsp
                     c->vMeters[j]           = GAIN_AMP_M_INF_DB;
                     c->bFft[j]              = true;
                 }
+                c->bShared              = false;
 
                 c->pIn                  = NULL;
                 c->pOut                 = NULL;
@@ -351,6 +490,8 @@ namespace lsp
             BIND_PORT(pType);
             BIND_PORT(pMode);
             BIND_PORT(pSlope);
+            BIND_PORT(pPartition);
+            BIND_PORT(pResolution);
             SKIP_PORT("Show dry/wet overlay");
             BIND_PORT(pDry);
             BIND_PORT(pWet);
@@ -361,9 +502,11 @@ namespace lsp
             BIND_PORT(pShift);
             BIND_PORT(pFilterMesh);
             BIND_PORT(pMeterMesh);
+            BIND_PORT(pDspLoad);
 
             if (nChannels > 1)
                 BIND_PORT(pSource);
+            BIND_PORT(pThreading);
 
             // Bind FFT switches
             for (size_t i=0; i<nChannels; ++i)
@@ -416,6 +559,9 @@ namespace lsp
 
             // Initialize buffers
             dsp::fill_zero(vEmptyBuffer, BUFFER_SIZE);
+
+            // The worker and analyzer threads are started by the executor when they are needed
+            pExecutor           = (wrapper != NULL) ? wrapper->executor() : NULL;
         }
 
         void mb_ringmod_sc::destroy()
@@ -426,8 +572,21 @@ namespace lsp
 
         void mb_ringmod_sc::do_destroy()
         {
+            // Stop the worker thread, wait for the pending start or stop of threads
+            while ((!sThreadControl.idle()) && (!sThreadControl.completed()))
+                ipc::Thread::sleep(1);
+            sWorker.stop();
+            bWorker             = false;
+            bAnalyzer           = false;
+
             // Destroy analyzer
             sAnalyzer.destroy();
+            sInTap.destroy();
+            sScTap.destroy();
+            sFFTCrossover.destroy();
+            sFFTScCrossover.destroy();
+            sFIRCrossover.destroy();
+            sFIRScCrossover.destroy();
 
             // Destroy channels
             if (vChannels != NULL)
@@ -442,14 +601,13 @@ namespace lsp
                     c->sDryDelay.destroy();
                     c->sCrossover.destroy();
                     c->sScCrossover.destroy();
-                    c->sFFTCrossover.destroy();
-                    c->sFFTScCrossover.destroy();
 
                     for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
                     {
                         ch_band_t *cb   = &c->vBands[j];
 
                         cb->sEnvDelay.destroy();
+                        cb->sEnvMax.destroy();
                     }
                 }
                 vChannels   = NULL;
@@ -481,16 +639,28 @@ namespace lsp
         void mb_ringmod_sc::update_sample_rate(long sr)
         {
             const size_t fft_rank       = select_fft_rank(sr);
-            const size_t in_max_delay   = dspu::millis_to_samples(sr, meta::mb_ringmod_sc::LOOKAHEAD_MAX) + BUFFER_SIZE;
+            // The pipelined processing delays the signal at least by the block size
+            const size_t in_max_delay   =
+                lsp_max(size_t(dspu::millis_to_samples(sr, meta::mb_ringmod_sc::LOOKAHEAD_MAX)), BUFFER_SIZE) +
+                BUFFER_SIZE;
             const size_t sc_max_delay   =
                 in_max_delay +
                 dspu::millis_to_samples(sr, meta::mb_ringmod_sc::DUCK_MAX) ;
-            const size_t fft_max_delay  = (1 << fft_rank) + BUFFER_SIZE;
 
             // Update analyzer's sample rate
             sAnalyzer.set_sample_rate(sr);
             sCounter.set_sample_rate(sr, true);
 
+            // Update FFT crossovers
+            sFFTCrossover.set_sample_rate(sr);
+            sFFTScCrossover.set_sample_rate(sr);
+            sInTap.set_sample_rate(sr);
+            sScTap.set_sample_rate(sr);
+            sFIRCrossover.set_sample_rate(sr);
+            sFIRScCrossover.set_sample_rate(sr);
+            init_xover_crossovers(fft_rank + 1);
+            update_xover_rank(fft_rank);
+
             // Update channels
             for (size_t i=0; i<nChannels; ++i)
             {
@@ -499,42 +669,128 @@ namespace lsp
                 c->sBypass.init(sr);
                 c->sInDelay.init(in_max_delay);
                 c->sScDelay.init(in_max_delay);
-                c->sDryDelay.init(fft_max_delay);
                 c->sCrossover.set_sample_rate(sr);
                 c->sScCrossover.set_sample_rate(sr);
-                c->sFFTCrossover.set_sample_rate(sr);
-                c->sFFTScCrossover.set_sample_rate(sr);
-
-                // Need to re-initialize FFT crossovers?
-                if (fft_rank != c->sFFTCrossover.rank())
-                {
-                    c->sFFTCrossover.init(fft_rank, meta::mb_ringmod_sc::BANDS_MAX);
-                    c->sFFTScCrossover.init(fft_rank, meta::mb_ringmod_sc::BANDS_MAX);
-                    for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
-                    {
-                        c->sFFTCrossover.set_handler(j, process_band, this, c);
-                        c->sFFTScCrossover.set_handler(j, process_sc_band, this, c);
-                    }
-                    c->sFFTCrossover.set_phase(float(i) / nChannels);
-                    c->sFFTScCrossover.set_phase(float(i) / nChannels);
-                }
 
                 for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
                 {
                     ch_band_t *cb   = &c->vBands[j];
 
                     cb->sEnvDelay.init(sc_max_delay);
+                    cb->sEnvMax.init(sc_max_delay + 1);
 
                     c->sCrossover.set_handler(j, process_band, this, c);
                     c->sScCrossover.set_handler(j, process_sc_band, this, c);
                 }
             }
 
+            // Update idle detection
+            nIdleDelay          = dspu::millis_to_samples(sr, IDLE_HOLD_TIME);
+            nIdleSamples        = 0;
+            bIdle               = false;
+
+            // Time constants depend on the sample rate
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+                vBands[i].fRelease  = -1.0f;
+
             // Need to synchronize filters
             bUpdFilters         = true;
             bSyncFilters        = true;
         }
 
+        void mb_ringmod_sc::init_xover_crossovers(size_t max_rank)
+        {
+            if (max_rank == sFFTCrossover.max_rank())
+                return;
+
+            // Allocate linear-phase crossovers for the highest resolution, so the
+            // resolution can be changed later without reallocation
+            sFFTCrossover.init(max_rank, meta::mb_ringmod_sc::BANDS_MAX);
+            sFFTScCrossover.init(max_rank, meta::mb_ringmod_sc::BANDS_MAX);
+            sFIRCrossover.init(max_rank, nPartRank, meta::mb_ringmod_sc::BANDS_MAX);
+            sFIRScCrossover.init(max_rank, nPartRank, meta::mb_ringmod_sc::BANDS_MAX);
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c = &vChannels[i];
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
+                {
+                    sFFTCrossover.set_handler(i, j, process_band, this, c);
+                    sFFTScCrossover.set_handler(i, j, process_sc_band, this, c);
+                    sFIRCrossover.set_handler(i, j, process_band, this, c);
+                    sFIRScCrossover.set_handler(i, j, process_sc_band, this, c);
+                }
+
+                // The dry signal delay should compensate the latency of the crossover
+                c->sDryDelay.init((1 << max_rank) + BUFFER_SIZE);
+            }
+            sFFTCrossover.set_spectrum_handler(process_spectrum, this, &sInTap);
+            sFFTScCrossover.set_spectrum_handler(process_spectrum, this, &sScTap);
+
+            // Both channels are processed at once, shift the sidechain crossover frames
+            // relative to the input crossover frames to distribute the FFT load
+            sFFTCrossover.set_phase(0.0f);
+            sFFTScCrossover.set_phase(0.5f);
+
+            // Need to synchronize filters
+            bUpdFilters         = true;
+        }
+
+        void mb_ringmod_sc::update_xover_rank(size_t rank)
+        {
+            if (rank == sFFTCrossover.rank())
+                return;
+
+            sFFTCrossover.set_rank(rank);
+            sFFTScCrossover.set_rank(rank);
+            sFIRCrossover.set_rank(rank, nPartRank);
+            sFIRScCrossover.set_rank(rank, nPartRank);
+
+            // Need to synchronize filters
+            bUpdFilters         = true;
+        }
+
+        size_t mb_ringmod_sc::select_xover_rank(band_t * const *plan, size_t plan_size) const
+        {
+            const size_t rank       = select_fft_rank(fSampleRate);
+
+            switch (size_t(pResolution->value()))
+            {
+                case RES_LOW:
+                    return rank - 1;
+                case RES_HIGH:
+                    return rank + 1;
+                case RES_AUTO:
+                {
+                    // plan[1] is the lowest split since the plan is sorted. Select the smallest
+                    // rank which gives enough FFT bins below the lowest split frequency
+                    if (plan_size < 2)
+                        return meta::mb_ringmod_sc::FFT_XOVER_RANK_LOW;
+
+                    const float freq        = lsp_max(plan[1]->fFreqStart, meta::mb_ringmod_sc::FREQ_MIN);
+
+                    // Changing the rank resets the crossovers, so keep the current rank while
+                    // it gives enough bins and the twice shorter FFT does not have a margin
+                    // of another factor of two
+                    const size_t curr_rank  = sFFTCrossover.rank();
+                    if ((curr_rank >= meta::mb_ringmod_sc::FFT_XOVER_RANK_LOW) && (curr_rank <= rank + 1))
+                    {
+                        const float bins        = (freq * float(size_t(1) << curr_rank)) / fSampleRate;
+                        if ((bins >= meta::mb_ringmod_sc::FFT_XOVER_RES_BINS) &&
+                            (bins < meta::mb_ringmod_sc::FFT_XOVER_RES_BINS * 4))
+                            return curr_rank;
+                    }
+
+                    const size_t length     = fSampleRate * meta::mb_ringmod_sc::FFT_XOVER_RES_BINS / freq;
+                    const size_t auto_rank  = int_log2(length) + 1;
+                    return lsp_limit(auto_rank, meta::mb_ringmod_sc::FFT_XOVER_RANK_LOW, rank + 1);
+                }
+                default:
+                    break;
+            }
+
+            return rank;
+        }
+
         void mb_ringmod_sc::update_premix()
         {
             sPremix.fInToSc     = (sPremix.pInToSc != NULL)     ? sPremix.pInToSc->value()      : GAIN_AMP_M_INF_DB;
@@ -543,6 +799,42 @@ namespace lsp
             sPremix.fLinkToSc   = (sPremix.pLinkToSc != NULL)   ? sPremix.pLinkToSc->value()    : GAIN_AMP_M_INF_DB;
             sPremix.fScToIn     = (sPremix.pScToIn != NULL)     ? sPremix.pScToIn->value()      : GAIN_AMP_M_INF_DB;
             sPremix.fScToLink   = (sPremix.pScToLink != NULL)   ? sPremix.pScToLink->value()    : GAIN_AMP_M_INF_DB;
+
+            // Each row is the pre-mixed signal, each column is the gain of the source signal
+            const float premix[MIX_TOTAL][MIX_TOTAL] =
+            {
+                { 1.0f,                             premix_gain(sPremix.fScToIn),   premix_gain(sPremix.fLinkToIn)  },  // In
+                { premix_gain(sPremix.fInToSc),     1.0f,                           premix_gain(sPremix.fLinkToSc)  },  // Sc
+                { premix_gain(sPremix.fInToLink),   premix_gain(sPremix.fScToLink), 1.0f                            },  // Link
+            };
+
+            // Select the pre-mixed signal for the specific type of sidechain and the stereo source
+            const float *sc     = (nType == SC_TYPE_EXTERNAL) ? premix[MIX_SC] :
+                                  (nType == SC_TYPE_SHM_LINK) ? premix[MIX_LINK] :
+                                  premix[MIX_IN];
+            const size_t source = ((nChannels > 1) && (nSource <= SC_SRC_MAX)) ? nSource : SC_SRC_LEFT_RIGHT;
+            const float (*matrix)[2] = sc_source_matrix[source];
+
+            // Compile the mix of each channel, the sidechain may depend on both channels
+            for (size_t i=0; i<2; ++i)
+                for (size_t j=0; j<2; ++j)
+                    for (size_t k=0; k<MIX_TOTAL; ++k)
+                    {
+                        const bool valid                = (i < nChannels) && (j < nChannels);
+                        sPremix.vInMix[i].vGain[j][k]   = (valid && (i == j)) ? premix[MIX_IN][k] : 0.0f;
+                        sPremix.vScMix[i].vGain[j][k]   = (valid) ? matrix[i][j] * sc[k] : 0.0f;
+                    }
+
+            sPremix.nScPost     = (source == SC_SRC_MIN) ? MIX_POST_MIN :
+                                  (source == SC_SRC_MAX) ? MIX_POST_MAX :
+                                  MIX_POST_NONE;
+
+            // When both channels have the same mix, the sidechain signal is computed only once
+            sPremix.bScShared   = (nChannels > 1) && (sPremix.nScPost == MIX_POST_NONE);
+            for (size_t j=0; (sPremix.bScShared) && (j<2); ++j)
+                for (size_t k=0; k<MIX_TOTAL; ++k)
+                    if (sPremix.vScMix[0].vGain[j][k] != sPremix.vScMix[1].vGain[j][k])
+                        sPremix.bScShared   = false;
         }
 
         size_t mb_ringmod_sc::build_split_plan(band_t **plan)
@@ -566,13 +858,13 @@ namespace lsp
                 if (b->bActive != active)
                 {
                     b->bActive              = active;
-                    bUpdFilters             = true;
+                    b->bUpdChart            = true;
                 }
                 if (b->fFreqStart != freq)
                 {
                     b->fFreqStart           = freq;
                     if (b->bActive)
-                        bUpdFilters             = true;
+                        b->bUpdChart            = true;
                 }
 
                 if (b->bActive)
@@ -591,10 +883,18 @@ namespace lsp
                     }
             }
 
-            // Adjust end frequency for each band after sort
-            for (size_t j=0; j<plan_size-1; ++j)
-                plan[j]->fFreqEnd           = plan[j+1]->fFreqStart;
-            plan[plan_size-1]->fFreqEnd         = fSampleRate * 0.5f;
+            // Adjust end frequency for each band after sort, the band which end
+            // frequency has changed needs to update the transfer function
+            for (size_t j=0; j<plan_size; ++j)
+            {
+                band_t * const pb       = plan[j];
+                const float end         = (j < plan_size-1) ? plan[j+1]->fFreqStart : fSampleRate * 0.5f;
+                if (pb->fFreqEnd != end)
+                {
+                    pb->fFreqEnd            = end;
+                    pb->bUpdChart           = true;
+                }
+            }
 
             return plan_size;
         }
@@ -635,15 +935,25 @@ namespace lsp
                 c->sBypass.set_bypass(bypass);
             }
 
-            // Update pre-mix matrix
-            update_premix();
-
             // Update sidechain processing
             const uint32_t old_mode = nMode;
+            const bool was_active   = bActive;
 
             nType                   = pType->value();
             nSource                 = (pSource != NULL) ? pSource->value() : SC_SRC_LEFT_RIGHT;
+            update_premix();
+            const size_t threading  = (pThreading != NULL) ? pThreading->value() : 0;
+            nThreading              = decode_threading(threading);
             nMode                   = pMode->value();
+            const uint32_t slope    = pSlope->value();
+            if (slope != nSlope)
+            {
+                nSlope                  = slope;
+                bUpdFilters             = true;
+            }
+            nPartRank               = meta::mb_ringmod_sc::FIR_PART_RANK_MIN + size_t(pPartition->value());
+            sFIRCrossover.set_partition(nPartRank);
+            sFIRScCrossover.set_partition(nPartRank);
             bActive                 = pActive->value() >= 0.5f;
             bInvert                 = pInvert->value() >= 0.5f;
             fZoom                   = pZoom->value();
@@ -657,13 +967,22 @@ namespace lsp
                     channel_t *c        = &vChannels[i];
                     c->sInDelay.clear();
                     c->sScDelay.clear();
-                    c->sFFTCrossover.clear();
-                    c->sFFTScCrossover.clear();
                 }
+                sFFTCrossover.clear();
+                sFFTScCrossover.clear();
+                sFIRCrossover.clear();
+                sFIRScCrossover.clear();
+                sInTap.clear();
+                sScTap.clear();
             }
 
-            // Update analyzer parameters
+            // Update analyzer parameters. The spectra of input and sidechain signals are
+            // taken from the frames of the FFT crossovers, so only the output signal is
+            // passed to the analyzer in this mode
+            const bool fft_taps     = nMode == MODE_SPM;
             bool has_active_channels = false;
+            bool has_in_taps        = false;
+            bool has_sc_taps        = false;
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t * const c = &vChannels[i];
@@ -671,33 +990,78 @@ namespace lsp
                 for (size_t j=0; j<MTR_TOTAL; ++j)
                 {
                     const bool fft  = c->pFft[j]->value() >= 0.5f;
+                    const bool tap  = (fft_taps) && (j != MTR_OUT);
                     c->bFft[j]      = fft;
-                    sAnalyzer.enable_channel(i*MTR_TOTAL + j, fft);
-                    if (fft)
+                    sAnalyzer.enable_channel(i*MTR_TOTAL + j, (fft) && (!tap));
+                    if ((fft) && (!tap))
                         has_active_channels     = true;
                 }
+
+                has_in_taps         = has_in_taps || ((fft_taps) && (c->bFft[MTR_IN]));
+                has_sc_taps         = has_sc_taps || ((fft_taps) && (c->bFft[MTR_SC]));
             }
 
-            sAnalyzer.set_reactivity(pReactivity->value());
+            const float reactivity  = pReactivity->value();
+            const float shift       = (pShift != NULL) ? pShift->value() * 100.0f : 1.0f;
+            sAnalyzer.set_reactivity(reactivity);
             if (pShift != NULL)
-                sAnalyzer.set_shift(pShift->value() * 100.0f);
+                sAnalyzer.set_shift(shift);
             sAnalyzer.set_activity(has_active_channels > 0);
+            update_threads(threading > 0, has_active_channels);
 
-            // Update analyzer
-            if (sAnalyzer.needs_reconfiguration())
-            {
-                sAnalyzer.reconfigure();
-                sAnalyzer.get_frequencies(vFreqs, vIndexes, SPEC_FREQ_MIN, SPEC_FREQ_MAX, meta::mb_ringmod_sc::FFT_MESH_POINTS);
-            }
+            // The input crossover also provides the sidechain spectrum when it is shared
+            sInTap.set_reactivity(reactivity);
+            sInTap.set_shift(shift);
+            sInTap.set_active(has_in_taps || has_sc_taps);
+            sScTap.set_reactivity(reactivity);
+            sScTap.set_shift(shift);
+            sScTap.set_active(has_sc_taps);
 
             // Build split plan
             band_t *plan[meta::mb_ringmod_sc::BANDS_MAX];
-            build_split_plan(plan);
+            const size_t plan_size  = build_split_plan(plan);
+
+            // Update the resolution of linear-phase crossovers
+            update_xover_rank(select_xover_rank(plan, plan_size));
+
+            // Compute the mute state of bands. Muted and soloed-out bands have no output and
+            // do not pass the sidechain to the output, so they are excluded from processing
+            bool has_solo       = false;
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+            {
+                band_t * const b    = &vBands[i];
+                if ((b->bActive) && (b->pSolo->value() >= 0.5f))
+                    has_solo            = true;
+            }
+
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+            {
+                band_t * const b    = &vBands[i];
+                const bool solo     = b->pSolo->value() >= 0.5f;
+                const bool mute     = b->pMute->value() >= 0.5f;
+                const bool old_mute = b->bMute;
+
+                b->bMute            = mute || ((has_solo) && (!solo));
+                if ((!old_mute) || (b->bMute))
+                    continue;
+
+                // The envelope of the band has not been updated while the band was muted,
+                // start it from the clean state
+                for (size_t j=0; j<nChannels; ++j)
+                {
+                    ch_band_t * const cb    = &vChannels[j].vBands[i];
+                    cb->sEnvDelay.clear();
+                    cb->sEnvMax.clear();
+                    cb->fPeak               = 0.0f;
+                    cb->nHold               = 0;
+                }
+            }
+            nSliceSize          = select_slice_size();
 
             // Update crossover split points
             if (nMode == MODE_IIR)
             {
-                const size_t iir_slope  = decode_iir_slope(pSlope->value());
+                const size_t iir_slope  = decode_iir_slope(nSlope);
 
                 for (size_t i=0; i<nChannels; ++i)
                 {
@@ -717,102 +1081,128 @@ namespace lsp
                     }
 
                     if (c->sCrossover.needs_reconfiguration())
-                    {
-                        bUpdFilters         = true;
                         c->sCrossover.reconfigure();
-                    }
                     if (c->sScCrossover.needs_reconfiguration())
-                    {
-                        bUpdFilters         = true;
                         c->sScCrossover.reconfigure();
-                    }
                 }
             }
-            else // nMode = MODE_SPM
+            else if (nMode == MODE_SPM)
             {
-                const float  fft_slope  = decode_spm_slope(pSlope->value());
+                const float  fft_slope  = decode_spm_slope(nSlope);
 
-                for (size_t i=0; i<nChannels; ++i)
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
                 {
-                    channel_t * const c = &vChannels[i];
+                    band_t * const b    = &vBands[j];
 
-                    for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
+                    sFFTCrossover.enable_band(j, b->bActive);
+                    sFFTScCrossover.enable_band(j, b->bActive);
+                    sFFTCrossover.mute_band(j, b->bMute);
+                    sFFTScCrossover.mute_band(j, b->bMute);
+                    if (b->bActive)
                     {
-                        band_t * const b    = &vBands[j];
-
-                        c->sFFTCrossover.enable_band(j, b->bActive);
-                        c->sFFTScCrossover.enable_band(j, b->bActive);
-                        if (b->bActive)
-                        {
-                            const bool lpf_on   = b->fFreqEnd < fSampleRate * 0.5f;
-                            const bool hpf_on   = b->fFreqStart > 0.0f;
+                        const bool lpf_on   = b->fFreqEnd < fSampleRate * 0.5f;
+                        const bool hpf_on   = b->fFreqStart > 0.0f;
 
-                            c->sFFTCrossover.set_lpf(j, b->fFreqEnd, fft_slope, lpf_on);
-                            c->sFFTCrossover.set_hpf(j, b->fFreqStart, fft_slope, hpf_on);
+                        sFFTCrossover.set_lpf(j, b->fFreqEnd, fft_slope, lpf_on);
+                        sFFTCrossover.set_hpf(j, b->fFreqStart, fft_slope, hpf_on);
 
-                            c->sFFTScCrossover.set_lpf(j, b->fFreqEnd, fft_slope, lpf_on);
-                            c->sFFTScCrossover.set_hpf(j, b->fFreqStart, fft_slope, hpf_on);
-                        }
+                        sFFTScCrossover.set_lpf(j, b->fFreqEnd, fft_slope, lpf_on);
+                        sFFTScCrossover.set_hpf(j, b->fFreqStart, fft_slope, hpf_on);
                     }
+                }
 
-                    if (c->sFFTCrossover.needs_update())
-                    {
-                        bUpdFilters         = true;
-                        c->sFFTCrossover.update_settings();
-                    }
-                    if (c->sFFTScCrossover.needs_update())
+                if (sFFTCrossover.needs_update())
+                    sFFTCrossover.update_settings();
+                if (sFFTScCrossover.needs_update())
+                    sFFTScCrossover.update_settings();
+            }
+            else // nMode == MODE_LL
+            {
+                const float  fft_slope  = decode_spm_slope(nSlope);
+
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
+                {
+                    band_t * const b    = &vBands[j];
+
+                    sFIRCrossover.enable_band(j, b->bActive);
+                    sFIRScCrossover.enable_band(j, b->bActive);
+                    sFIRCrossover.mute_band(j, b->bMute);
+                    sFIRScCrossover.mute_band(j, b->bMute);
+                    if (b->bActive)
                     {
-                        bUpdFilters         = true;
-                        c->sFFTScCrossover.update_settings();
+                        const bool lpf_on   = b->fFreqEnd < fSampleRate * 0.5f;
+                        const bool hpf_on   = b->fFreqStart > 0.0f;
+
+                        sFIRCrossover.set_lpf(j, b->fFreqEnd, fft_slope, lpf_on);
+                        sFIRCrossover.set_hpf(j, b->fFreqStart, fft_slope, hpf_on);
+
+                        sFIRScCrossover.set_lpf(j, b->fFreqEnd, fft_slope, lpf_on);
+                        sFIRScCrossover.set_hpf(j, b->fFreqStart, fft_slope, hpf_on);
                     }
                 }
+
+                if (sFIRCrossover.needs_update())
+                    sFIRCrossover.update_settings();
+                if (sFIRScCrossover.needs_update())
+                    sFIRScCrossover.update_settings();
             }
 
-            // Check that we need to update band filter curves
-            if (bUpdFilters)
+            // Update filter curves of the bands which split points have changed. The
+            // magnitude response of the band depends on it's own split points only,
+            // the change of the mode, slope or sample rate affects all bands
+            channel_t * const c0    = &vChannels[0];
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
             {
-                bUpdFilters         = false;
-                bSyncFilters        = true;
-                channel_t * const c = &vChannels[0];
+                band_t * const b        = &vBands[i];
+                if ((!bUpdFilters) && (!b->bUpdChart))
+                    continue;
 
-                for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+                b->bUpdChart            = false;
+                bSyncFilters            = true;
+                if (b->bActive)
                 {
-                    // Configure split point
-                    band_t * const b        = &vBands[i];
-                    if (b->bActive)
+                    if (nMode == MODE_IIR)
                     {
-                        if (nMode == MODE_IIR)
-                        {
-                            c->sCrossover.freq_chart(i, vBuffer, vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS);
-                            dsp::pcomplex_mod(b->vTr, vBuffer, meta::mb_ringmod_sc::FFT_MESH_POINTS);
-                        }
-                        else
-                            c->sFFTCrossover.freq_chart(i, b->vTr, vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                        c0->sCrossover.freq_chart(i, vBuffer, vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                        dsp::pcomplex_mod(b->vTr, vBuffer, meta::mb_ringmod_sc::FFT_MESH_POINTS);
                     }
+                    else if (nMode == MODE_SPM)
+                        sFFTCrossover.freq_chart(i, b->vTr, vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS);
                     else
-                        dsp::fill_zero(b->vTr, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                        sFIRCrossover.freq_chart(i, b->vTr, vFreqs, meta::mb_ringmod_sc::FFT_MESH_POINTS);
                 }
+                else
+                    dsp::fill_zero(b->vTr, meta::mb_ringmod_sc::FFT_MESH_POINTS);
             }
+            bUpdFilters         = false;
 
             // Compute settings for each band
-            bool has_solo       = false;
             nLatency            = 0;
             for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
             {
                 band_t * const b    = &vBands[i];
                 const float release = b->pRelease->value();
 
-                b->fTauRelease      = 1.0f - expf(logf(1.0f - M_SQRT1_2) / (dspu::millis_to_samples(fSampleRate, release)));
+                if (b->fRelease != release)
+                {
+                    b->fRelease         = release;
+                    b->fTauRelease      = 1.0f - expf(logf(1.0f - M_SQRT1_2) / (dspu::millis_to_samples(fSampleRate, release)));
+                }
                 b->nHold            = dspu::millis_to_samples(fSampleRate, b->pHold->value());
                 b->nLatency         = dspu::millis_to_samples(fSampleRate, b->pLookahead->value());
-                b->nDuck            = nLatency + dspu::millis_to_samples(fSampleRate, b->pDuck->value());
+                b->nDuck            = dspu::millis_to_samples(fSampleRate, b->pDuck->value());
                 b->fGain            = b->pGain->value();
                 b->fStereoLink      = (b->pStereoLink != NULL) ? lsp_max(b->pStereoLink->value() * 0.01f, 0.0f) : 0.0f;
                 b->fAmount          = dspu::db_to_gain(b->pAmount->value());
-                b->bOn              = b->pOn->value() >= 0.5f;
 
-                if ((!has_solo) && (b->bActive))
-                    has_solo            = b->pSolo->value() >= 0.5f;
+                // The window of the envelope maximum is not updated while the band is not processed
+                const bool on       = b->pOn->value() >= 0.5f;
+                if ((on) && (bActive) && ((!b->bOn) || (!was_active)))
+                {
+                    for (size_t j=0; j<nChannels; ++j)
+                        vChannels[j].vBands[i].sEnvMax.clear();
+                }
+                b->bOn              = on;
 
                 nLatency            = lsp_max(nLatency, b->nLatency);
             }
@@ -820,13 +1210,35 @@ namespace lsp
             for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
             {
                 band_t * const b    = &vBands[i];
-                const bool solo     = b->pSolo->value() >= 0.5f;
-                const bool mute     = b->pMute->value() >= 0.5f;
-
-                b->bMute            = mute || ((has_solo) && (!solo));
                 b->nLatency         = nLatency - b->nLatency;
             }
 
+            // In pipelined mode the envelope of the block becomes available for the next block only,
+            // so the lookahead pays for the pipeline depth and the signal is additionally delayed only
+            // if the lookahead is less than the block size
+            if (nThreading == MT_PIPELINE)
+            {
+                const uint32_t latency  = lsp_max(nLatency, uint32_t(BUFFER_SIZE));
+                for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+                {
+                    band_t * const b    = &vBands[i];
+                    b->nLatency         = lsp_max(b->nLatency + latency - nLatency, uint32_t(BUFFER_SIZE));
+                }
+                nLatency            = latency;
+            }
+
+            // The envelope is delayed by the band latency and then maximized over the window
+            // which covers both lookahead and duck intervals, the duck interval ends after the
+            // overall latency of the plugin
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+            {
+                band_t * const b    = &vBands[i];
+                b->nDuck           += nLatency;
+                const size_t window = b->nDuck - b->nLatency + 1;
+                for (size_t j=0; j<nChannels; ++j)
+                    vChannels[j].vBands[i].sEnvMax.set_window(window);
+            }
+
             // Configure loudness
             const float out_gain    = pGainOut->value();
             const float dry_gain    = pDry->value();
@@ -843,7 +1255,10 @@ namespace lsp
             bOutSc                  = pOutSc->value() >= 0.5f;
 
             // Apply latency compensation and report latency
-            const size_t xover_latency = (nMode == MODE_SPM) ? vChannels[0].sFFTCrossover.latency() : 0;
+            const size_t xover_latency =
+                (nMode == MODE_SPM) ? sFFTCrossover.latency() :
+                (nMode == MODE_LL) ? sFIRCrossover.latency() :
+                0;
 
             for (size_t i=0; i<nChannels; ++i)
             {
@@ -859,347 +1274,582 @@ namespace lsp
 
         void mb_ringmod_sc::ui_activated()
         {
+            bUiActive           = true;
             bSyncFilters        = true;
         }
 
+        void mb_ringmod_sc::ui_deactivated()
+        {
+            bUiActive           = false;
+        }
+
+        float *mb_ringmod_sc::mix_stream(float *dst, const mix_row_t *row, float * const *src, size_t samples)
+        {
+            float *vsrc[2 * MIX_TOTAL];
+            float vk[2 * MIX_TOTAL];
+            size_t n = 0;
+
+            // Collect the contributing sources, the link buffer may be not available
+            for (size_t i=0; i<nChannels; ++i)
+                for (size_t j=0; j<MIX_TOTAL; ++j)
+                {
+                    float * const buf   = src[i * MIX_TOTAL + j];
+                    const float k       = row->vGain[i][j];
+                    if ((buf == NULL) || (k == 0.0f))
+                        continue;
+
+                    vsrc[n]             = buf;
+                    vk[n]               = k;
+                    ++n;
+                }
+
+            // Empty and identity mixes do not require any computation
+            if (n <= 0)
+                return vEmptyBuffer;
+            if ((n == 1) && (vk[0] == 1.0f))
+                return vsrc[0];
+
+            rmod::mix_sources(dst, vsrc, vk, n, samples);
+            return dst;
+        }
+
         void mb_ringmod_sc::premix_channels(size_t samples)
         {
+            float *src[2][MIX_TOTAL];
+
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t * const c = &vChannels[i];
 
                 // Get pointers to buffers and advance position
-                float * const in_buf    = c->vIn;
-                float * const sc_buf    = c->vSc;
-                float * const link_buf  = c->vLink;
-                float * const out_buf   = c->vOut;
-
-                c->vInPtr               = in_buf;
-                c->vScPtr               = sc_buf;
-                c->vLinkPtr             = link_buf;
-                c->vOutPtr              = out_buf;
+                src[i][MIX_IN]          = c->vIn;
+                src[i][MIX_SC]          = c->vSc;
+                src[i][MIX_LINK]        = c->vLink;
+                c->vOutPtr              = c->vOut;
 
-                // Update pointers
                 c->vIn                 += samples;
-                c->vSc                 += samples;
+                c->vSc                  = (c->vSc != NULL) ? c->vSc + samples : NULL;
                 c->vLink                = (c->vLink != NULL) ? c->vLink + samples : NULL;
                 c->vOut                += samples;
-
-                // Perform transformation
-                // (Sc, Link) -> In
-                if ((sc_buf != NULL) && (sPremix.fScToIn > GAIN_AMP_M_INF_DB))
-                {
-                    c->vInPtr               = c->vTmpIn;
-                    dsp::fmadd_k4(c->vInPtr, in_buf, sc_buf, sPremix.fScToIn, samples);
-
-                    if ((link_buf != NULL) && (sPremix.fLinkToIn > GAIN_AMP_M_INF_DB))
-                        dsp::fmadd_k3(c->vInPtr, link_buf, sPremix.fLinkToIn, samples);
-                }
-                else if ((link_buf != NULL) && (sPremix.fLinkToIn > GAIN_AMP_M_INF_DB))
-                {
-                    c->vInPtr               = c->vTmpIn;
-                    dsp::fmadd_k4(c->vInPtr, in_buf, link_buf, sPremix.fLinkToIn, samples);
-                }
-
-                // (In, Link) -> Sc
-                if (sPremix.fInToSc > GAIN_AMP_M_INF_DB)
-                {
-                    c->vScPtr               = c->vTmpSc;
-                    if (sc_buf != NULL)
-                        dsp::fmadd_k4(c->vScPtr, sc_buf, in_buf, sPremix.fInToSc, samples);
-                    else
-                        dsp::mul_k3(c->vScPtr, in_buf, sPremix.fInToSc, samples);
-
-                    if ((link_buf != NULL) && (sPremix.fLinkToSc > GAIN_AMP_M_INF_DB))
-                        dsp::fmadd_k3(c->vScPtr, link_buf, sPremix.fLinkToSc, samples);
-                }
-                else if ((link_buf != NULL) && (sPremix.fLinkToSc > GAIN_AMP_M_INF_DB))
-                {
-                    c->vScPtr               = c->vTmpSc;
-                    if (sc_buf != NULL)
-                        dsp::fmadd_k4(c->vScPtr, sc_buf, link_buf, sPremix.fLinkToSc, samples);
-                    else
-                        dsp::mul_k3(c->vScPtr, link_buf, sPremix.fLinkToSc, samples);
-                }
-
-                // (In, Sc) -> Link
-                if (sPremix.fInToLink > GAIN_AMP_M_INF_DB)
-                {
-                    c->vLinkPtr             = c->vTmpLink;
-                    if (link_buf != NULL)
-                        dsp::fmadd_k4(c->vLinkPtr, link_buf, in_buf, sPremix.fInToLink, samples);
-                    else
-                        dsp::mul_k3(c->vLinkPtr, in_buf, sPremix.fInToLink, samples);
-
-                    if ((sc_buf != NULL) && (sPremix.fScToLink > GAIN_AMP_M_INF_DB))
-                        dsp::fmadd_k3(c->vLinkPtr, sc_buf, sPremix.fScToLink, samples);
-                }
-                else if ((sc_buf != NULL) && (sPremix.fScToLink > GAIN_AMP_M_INF_DB))
-                {
-                    c->vLinkPtr             = c->vTmpLink;
-                    if (link_buf != NULL)
-                        dsp::fmadd_k4(c->vLinkPtr, link_buf, sc_buf, sPremix.fScToLink, samples);
-                    else
-                        dsp::mul_k3(c->vLinkPtr, sc_buf, sPremix.fScToLink, samples);
-                }
             }
-        }
 
-        void mb_ringmod_sc::process_sidechain_type(size_t samples)
-        {
-            // Select the source for the specific type of sidechain
+            // Compute the input signal of each channel
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t * const c = &vChannels[i];
-                float *buf          = (nType == SC_TYPE_EXTERNAL) ? c->vScPtr :
-                                      (nType == SC_TYPE_SHM_LINK) ? c->vLinkPtr :
-                                      c->vInPtr;
-
-                c->vScPtr           = (buf != NULL) ? buf : vEmptyBuffer;
+                c->vInPtr               = mix_stream(c->vTmpIn, &sPremix.vInMix[i], src[0], samples);
             }
 
-            // Apply sidechain pre-processing depending on selected source (stereo only)
+            // Compute the sidechain signal of each channel
+            channel_t * const l     = &vChannels[0];
+            l->vScPtr               = mix_stream(l->vTmpSc, &sPremix.vScMix[0], src[0], samples);
             if (nChannels <= 1)
                 return;
 
-            channel_t * const l = &vChannels[0];
-            channel_t * const r = &vChannels[1];
+            channel_t * const r     = &vChannels[1];
+            r->vScPtr               = (sPremix.bScShared) ? l->vScPtr : mix_stream(r->vTmpSc, &sPremix.vScMix[1], src[0], samples);
 
-            switch (nSource)
+            switch (sPremix.nScPost)
             {
-                case SC_SRC_RIGHT_LEFT:
-                    lsp::swap(l->vScPtr[0], l->vScPtr[1]);
-                    break;
-
-                case SC_SRC_LEFT:
-                    r->vScPtr[1]    = l->vScPtr[0];
-                    break;
-
-                case SC_SRC_RIGHT:
-                    l->vScPtr[0]    = r->vScPtr[1];
-                    break;
-
-                case SC_SRC_MID_SIDE:
-                    dsp::lr_to_ms(l->vTmpSc, r->vTmpSc, l->vScPtr, r->vScPtr, samples);
-                    l->vScPtr   = l->vTmpSc;
-                    r->vScPtr   = r->vTmpSc;
-                    break;
-
-                case SC_SRC_SIDE_MID:
-                    dsp::lr_to_ms(r->vTmpSc, l->vTmpSc, l->vScPtr, r->vScPtr, samples);
-                    l->vScPtr   = l->vTmpSc;
-                    r->vScPtr   = r->vTmpSc;
-                    break;
-
-                case SC_SRC_MIDDLE:
-                    dsp::lr_to_mid(r->vTmpSc, l->vScPtr, r->vScPtr, samples);
-                    l->vScPtr   = r->vTmpSc;
-                    r->vScPtr   = r->vTmpSc;
-                    break;
-
-                case SC_SRC_SIDE:
-                    dsp::lr_to_side(r->vTmpSc, l->vScPtr, r->vScPtr, samples);
-                    l->vScPtr   = r->vTmpSc;
-                    r->vScPtr   = r->vTmpSc;
-                    break;
-
-                case SC_SRC_MIN:
+                case MIX_POST_MIN:
                     dsp::pamin3(r->vTmpSc, l->vScPtr, r->vScPtr, samples);
                     l->vScPtr   = r->vTmpSc;
                     r->vScPtr   = r->vTmpSc;
                     break;
 
-                case SC_SRC_MAX:
+                case MIX_POST_MAX:
                     dsp::pamax3(r->vTmpSc, l->vScPtr, r->vScPtr, samples);
                     l->vScPtr   = r->vTmpSc;
                     r->vScPtr   = r->vTmpSc;
                     break;
 
-                case SC_SRC_LEFT_RIGHT: // already properly mapped
+                case MIX_POST_NONE:
                 default:
                     break;
             }
         }
 
-        void mb_ringmod_sc::process_sidechain_envelope(size_t samples)
+        void mb_ringmod_sc::prepare_sidechain()
         {
-            // Process sidechain envelope for each band
+            // When both channels refer to the same sidechain signal (middle, side, min, max),
+            // the envelope is computed for the left channel only and then passed to the right one
+            bScMono                     = (nChannels > 1) && (vChannels[0].vScPtr == vChannels[1].vScPtr);
+            const size_t sc_channels    = (bScMono) ? 1 : nChannels;
+
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
-                dsp::fill_zero(c->vSidechain, samples);
 
-                if (nMode == MODE_IIR)
-                    c->sScCrossover.process(c->vScPtr, samples);
-                else
-                    c->sFFTScCrossover.process(c->vScPtr, samples);
+                // When the sidechain is the same signal as the input and there is no latency
+                // compensation for the input, the band split of the input crossover can be
+                // used for both sidechain and input processing
+                c->bShared          = (i < sc_channels) && (nLatency == 0) && (c->vScPtr == c->vInPtr);
             }
 
-            // Perform stereo linking between left and right channels for each band
-            if (nChannels < 2)
-                return;
+            // Linear-phase crossover processes all channels at once, so it can be shared between
+            // input and sidechain only if it can be shared for all channels
+            if ((nMode != MODE_IIR) && (sc_channels > 1))
+            {
+                const bool shared   = (vChannels[0].bShared) && (vChannels[1].bShared);
+                vChannels[0].bShared    = shared;
+                vChannels[1].bShared    = shared;
+            }
+        }
+
+        void mb_ringmod_sc::process_sidechain_envelope(size_t samples)
+        {
+            prepare_sidechain();
+            follow_sidechain(samples);
+            apply_envelope_delays(samples);
+        }
+
+        void mb_ringmod_sc::follow_sidechain(size_t samples)
+        {
+            const size_t sc_channels    = (bScMono) ? 1 : nChannels;
+
+            for (size_t i=0; i<sc_channels; ++i)
+                dsp::fill_zero(vChannels[i].vSidechain, samples);
+
+            // Split the sidechain of each channel into bands, the right channel
+            // is processed by the worker thread if parallel processing is enabled
+            if (nMode == MODE_IIR)
+            {
+                if ((sc_channels > 1) && (submit_right_channel(sc_split_task, samples)))
+                {
+                    process_sc_split(&vChannels[0], samples);
+                    sWorker.wait();
+                }
+                else
+                {
+                    for (size_t i=0; i<sc_channels; ++i)
+                        process_sc_split(&vChannels[i], samples);
+                }
+            }
+            else
+            {
+                channel_t * const l = &vChannels[0];
+                channel_t * const r = (sc_channels > 1) ? &vChannels[1] : NULL;
+
+                if (l->bShared)
+                    process_crossover(l->vScPtr, (r != NULL) ? r->vScPtr : NULL, samples);
+                else
+                    process_sc_crossover(l->vScPtr, (r != NULL) ? r->vScPtr : NULL, samples);
+            }
+
+            // Now each active band contains band-filtered sidechain signal,
+            // transform it into envelope for all bands of all channels at once
+            float *env[FOLLOWERS_MAX];
+            float peak[FOLLOWERS_MAX];
+            uint32_t hold[FOLLOWERS_MAX];
+            float tau[FOLLOWERS_MAX];
+            uint32_t hold_max[FOLLOWERS_MAX];
+            size_t bands[FOLLOWERS_MAX];
+            ch_band_t *cbands[FOLLOWERS_MAX];
+            size_t lanes        = 0;
+
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+            {
+                band_t * const b    = &vBands[i];
+                if ((!b->bActive) || (b->bMute))
+                    continue;
+
+                for (size_t j=0; j<sc_channels; ++j)
+                {
+                    ch_band_t * const cb    = &vChannels[j].vBands[i];
+
+                    env[lanes]          = cb->vEnvelope;
+                    peak[lanes]         = cb->fPeak;
+                    hold[lanes]         = cb->nHold;
+                    tau[lanes]          = b->fTauRelease;
+                    hold_max[lanes]     = b->nHold;
+                    bands[lanes]        = i;
+                    cbands[lanes]       = cb;
+                    ++lanes;
+                }
+            }
+
+            const rmod::follower_t f = { peak, hold, tau, hold_max };
+            rmod::follow_envelope(env, &f, fScGain, lanes, samples);
+
+            // Update parameters
+            for (size_t i=0; i<lanes; ++i)
+            {
+                ch_band_t * const cb    = cbands[i];
+                cb->fPeak           = (peak[i] >= ENV_FLOOR) ? peak[i] : 0.0f;
+                cb->nHold           = hold[i];
+
+                if (bScMono)
+                {
+                    // Keep the state of the right channel consistent for the case the
+                    // sidechain source becomes different for left and right channels
+                    ch_band_t * const rcb   = &vChannels[1].vBands[bands[i]];
+                    rcb->fPeak          = cb->fPeak;
+                    rcb->nHold          = cb->nHold;
+                }
+            }
+
+            // Pass the sidechain signal of the left channel to the right channel, envelopes
+            // are passed after applying the delays since they are the same for both channels
+            if (bScMono)
+                dsp::copy(vChannels[1].vSidechain, vChannels[0].vSidechain, samples);
+        }
+
+        void mb_ringmod_sc::apply_envelope_delays(size_t samples)
+        {
+            // In pipelined mode the envelope of the current block is not ready yet, the ring
+            // buffer contains envelopes up to the previous block and all delays are not less than
+            // the block size. Otherwise the envelope of the current block is appended first.
+            const bool pipelined        = nThreading == MT_PIPELINE;
+            const size_t offset         = (pipelined) ? 0 : samples;
+            const size_t sc_channels    = (bScMono) ? 1 : nChannels;
 
             for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
             {
                 band_t * const b        = &vBands[i];
-                if (!b->bActive)
+                if ((!b->bActive) || (b->bMute))
                     continue;
 
-                ch_band_t * const clb   = &vChannels[0].vBands[i];
-                ch_band_t * const crb   = &vChannels[1].vBands[i];
+                for (size_t j=0; j<sc_channels; ++j)
+                {
+                    ch_band_t * const cb    = &vChannels[j].vBands[i];
+                    float * const dst       = (pipelined) ? cb->vBandData : cb->vEnvelope;
 
-                const float slink   = b->fStereoLink;
-                if (slink <= 0.0f)
+                    // Now push the buffer contents to the ring buffer
+                    if (!pipelined)
+                    {
+                        cb->sEnvDelay.append(dst, samples);
+                        if (bScMono)
+                            vChannels[1].vBands[i].sEnvDelay.append(dst, samples);
+                    }
+
+                    if ((!b->bOn) || (!bActive))
+                    {
+                        if (pipelined)
+                            dsp::fill_zero(dst, samples);
+                        continue;
+                    }
+
+                    // Apply latency compensation, lookahead and ducking: take the envelope delayed
+                    // by the shortest delay and compute it's maximum over the window which ends
+                    // at the longest delay
+                    const float *env        = ((pipelined) || (b->nLatency > 0)) ?
+                                              cb->sEnvDelay.tail(offset + b->nLatency) : dst;
+                    cb->sEnvMax.process(dst, env, samples);
+                }
+
+                // Process the stereo envelopes of the band while they are still in the cache
+                if (nChannels < 2)
                     continue;
 
-                float *lbuf         = clb->vEnvelope;
-                float *rbuf         = crb->vEnvelope;
+                ch_band_t * const clb   = &vChannels[0].vBands[i];
+                ch_band_t * const crb   = &vChannels[1].vBands[i];
+                float * const lbuf      = (pipelined) ? clb->vBandData : clb->vEnvelope;
+                float * const rbuf      = (pipelined) ? crb->vBandData : crb->vEnvelope;
 
-                // For both channels: find the minimum one and try to raise to maximum one
-                // proportionally to the stereo link setup
-                for (size_t j=0; j<samples; ++j)
+                if (bScMono)
                 {
-                    const float ls      = lbuf[j];
-                    const float rs      = rbuf[j];
-                    if (ls < rs)
-                        lbuf[j]             = ls + (rs - ls) * slink;
-                    else
-                        rbuf[j]             = rs + (ls - rs) * slink;
+                    // Pass the envelope of the left channel to the right channel,
+                    // stereo linking has no effect since envelopes are the same for both channels
+                    dsp::copy(rbuf, lbuf, samples);
+                }
+                else if (b->fStereoLink > 0.0f)
+                {
+                    // For both channels: raise the minimum one to the maximum one
+                    // proportionally to the stereo link setup
+                    rmod::link_envelopes(lbuf, rbuf, b->fStereoLink, samples);
                 }
             }
         }
 
-        void mb_ringmod_sc::process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t samples)
+        void mb_ringmod_sc::append_envelopes(size_t samples)
         {
-            mb_ringmod_sc * const self  = static_cast<mb_ringmod_sc *>(object);
-            channel_t * const c         = static_cast<channel_t *>(subject);
-            ch_band_t * const cb        = &c->vBands[band];
-            band_t * const b            = &self->vBands[band];
-
-            const float * const env     = &cb->vEnvelope[sample];
-            float * tmp                 = NULL;
+            // Pass the raw envelopes of the left channel to the right channel
+            if (bScMono)
+            {
+                for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+                {
+                    if ((vBands[i].bActive) && (!vBands[i].bMute))
+                        vChannels[1].vBands[i].sEnvDelay.append(vChannels[0].vBands[i].vEnvelope, samples);
+                }
+            }
 
-            if ((b->bOn) && (self->bActive))
+            const size_t sc_channels    = (bScMono) ? 1 : nChannels;
+            for (size_t i=0; i<sc_channels; ++i)
             {
-                tmp                         = self->vBuffer;
-                // Compute the gain reduction
-                // cb->vScData contains sidechain envelope signal
-                // vBuffer will contain gain reduction
-                if (self->bInvert)
-                    dsp::mul_k3(tmp, env, b->fAmount * b->fGain, samples);
-                else
+                channel_t * const c = &vChannels[i];
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
                 {
-                    for (size_t j=0; j<samples; ++j)
-                        tmp[j]                      = lsp_max(0.0f, GAIN_AMP_0_DB - env[j] * b->fAmount) * b->fGain;
+                    if ((vBands[j].bActive) && (!vBands[j].bMute))
+                        c->vBands[j].sEnvDelay.append(c->vBands[j].vEnvelope, samples);
                 }
-                cb->fReduction              = lsp_min(cb->fReduction, dsp::abs_min(tmp, samples));
             }
+        }
 
-            if (b->bMute)
+        void mb_ringmod_sc::process_pipelined(size_t samples)
+        {
+            // The signal processing does not modify the pre-mixed data,
+            // so the worker thread can read the sidechain data in place
+            prepare_sidechain();
+
+            // Compute the envelope of the current block on the worker thread and
+            // process the signal using envelopes of previous blocks simultaneously
+            sTask.pChannel      = NULL;
+            sTask.nSamples      = samples;
+            sWorker.submit(sc_follow_task, &sTask);
+
+            apply_envelope_delays(samples);
+            process_signal(samples);
+
+            sWorker.wait();
+
+            // Now the sidechain processing results of the current block are available
+            append_envelopes(samples);
+            for (size_t i=0; i<nChannels; ++i)
+                process_channel_output(&vChannels[i], samples);
+        }
+
+        uint32_t mb_ringmod_sc::decode_threading(size_t value) const
+        {
+            // The worker thread is required for multi-threaded processing and should
+            // not be used while it is being started or stopped by the pending task
+            if ((!bWorker) || (!sThreadControl.idle()))
+                return MT_OFF;
+
+            // Mono version provides only Off and Pipeline modes
+            if (nChannels < 2)
+                return (value > 0) ? MT_PIPELINE : MT_OFF;
+
+            return uint32_t(value);
+        }
+
+        void mb_ringmod_sc::update_threads(bool worker, bool analyzer)
+        {
+            // The analyzer thread keeps running until the plugin is destroyed
+            analyzer            = (analyzer) || (bAnalyzer);
+            if ((worker == bWorker) && (analyzer == bAnalyzer))
                 return;
 
-            // Mix signal to input buffer after crossover
+            // Without the executor the plugin is driven outside of the real-time context,
+            // so the threads can be started immediately
+            if (pExecutor == NULL)
             {
-                float * const dst           = &c->vDataIn[sample];
-                dsp::fmadd_k3(dst, data, self->fInGain, samples);
+                sThreadControl.request(worker, analyzer);
+                sThreadControl.run();
+                bWorker             = sThreadControl.worker();
+                bAnalyzer           = sThreadControl.analyzer();
+                return;
             }
 
-            // Mix band signal to output if band is enabled
-            if (self->bOutIn)
-            {
-                float * const dst           = &c->vDataOut[sample];
+            // The processing remains single-threaded until the worker thread is started or stopped,
+            // the state of threads is requested again after the completion of the pending task
+            if (!sThreadControl.idle())
+                return;
+            sThreadControl.request(worker, analyzer);
+            pExecutor->submit(&sThreadControl);
+        }
+
+        void mb_ringmod_sc::sync_threads()
+        {
+            if (!sThreadControl.completed())
+                return;
 
-                // Pass dry (unprocessed) signal
-                const float dry_gain        = self->fInGain * self->fDryGain;
-                const float wet_gain        = self->fInGain * self->fWetGain;
-                if (dry_gain > GAIN_AMP_M_INF_DB)
-                    dsp::fmadd_k3(dst, data, dry_gain, samples);
+            bWorker             = sThreadControl.worker();
+            bAnalyzer           = sThreadControl.analyzer();
+            sThreadControl.reset();
 
-                // Apply gain reduction to the signal and mix wet signal to the data buffer
-                if (tmp != NULL)
-                {
-                    dsp::mul2(tmp, data, samples);
-                    dsp::fmadd_k3(dst, tmp, wet_gain, samples);
-                }
-                else
-                    dsp::fmadd_k3(dst, data, wet_gain, samples);
+            // The processing has been single-threaded while the task was pending, restore
+            // the processing mode and apply the settings changed in the meantime
+            pWrapper->request_settings_update();
+        }
+
+        uint32_t mb_ringmod_sc::select_slice_size() const
+        {
+            if (nSliceHint > 0)
+                return lsp_limit(nSliceHint, uint32_t(SLICE_SIZE_MIN), uint32_t(BUFFER_SIZE));
+
+            // The hand-off to the worker thread should be amortized by the large block
+            if (nThreading != MT_OFF)
+                return BUFFER_SIZE;
+
+            // All buffers touched by the slice should stay in the L1 cache between the
+            // sidechain and the signal processing stages
+            size_t bands        = 0;
+            for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+            {
+                if ((vBands[i].bActive) && (!vBands[i].bMute))
+                    ++bands;
             }
+
+            const size_t szof_sample    = nChannels * (bands * SLICE_BAND_BUFFERS + SLICE_CH_BUFFERS) * sizeof(float);
+            size_t slice        = BUFFER_SIZE;
+            while ((slice > SLICE_SIZE_MIN) && (slice * szof_sample > L1_CACHE_SIZE))
+                slice             >>= 1;
+
+            return uint32_t(slice);
         }
 
-        void mb_ringmod_sc::process_sc_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t samples)
+        void mb_ringmod_sc::process_sc_split(channel_t *c, size_t samples)
+        {
+            if (c->bShared)
+                c->sCrossover.process(c->vScPtr, samples);
+            else
+                c->sScCrossover.process(c->vScPtr, samples);
+        }
+
+        bool mb_ringmod_sc::submit_right_channel(rmod::Worker::task_t task, size_t samples)
+        {
+            if ((nChannels < 2) || (nThreading != MT_PARALLEL) || (!bWorker))
+                return false;
+
+            sTask.pChannel      = &vChannels[1];
+            sTask.nSamples      = samples;
+            sWorker.submit(task, &sTask);
+
+            return true;
+        }
+
+        void mb_ringmod_sc::sc_split_task(void *arg)
+        {
+            mt_task_t * const t = static_cast<mt_task_t *>(arg);
+
+            rmod::DenormalGuard guard;
+            t->pSelf->process_sc_split(t->pChannel, t->nSamples);
+        }
+
+        void mb_ringmod_sc::sc_follow_task(void *arg)
+        {
+            mt_task_t * const t = static_cast<mt_task_t *>(arg);
+
+            rmod::DenormalGuard guard;
+            t->pSelf->follow_sidechain(t->nSamples);
+        }
+
+        void mb_ringmod_sc::channel_signal_task(void *arg)
+        {
+            mt_task_t * const t = static_cast<mt_task_t *>(arg);
+
+            rmod::DenormalGuard guard;
+            t->pSelf->process_channel_signal(t->pChannel, t->nSamples);
+        }
+
+        void mb_ringmod_sc::process_crossover(const float *left, const float *right, size_t samples)
+        {
+            if (nMode == MODE_SPM)
+                sFFTCrossover.process(left, right, samples);
+            else
+                sFIRCrossover.process(left, right, samples);
+        }
+
+        void mb_ringmod_sc::process_sc_crossover(const float *left, const float *right, size_t samples)
+        {
+            if (nMode == MODE_SPM)
+                sFFTScCrossover.process(left, right, samples);
+            else
+                sFIRScCrossover.process(left, right, samples);
+        }
+
+        void mb_ringmod_sc::process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t samples)
         {
             mb_ringmod_sc * const self  = static_cast<mb_ringmod_sc *>(object);
             channel_t * const c         = static_cast<channel_t *>(subject);
             ch_band_t * const cb        = &c->vBands[band];
-            band_t * const b            = &self->vBands[band];
 
-            // Need to pass sidechain to output?
-            if ((!b->bMute) && (self->bOutSc) && (self->fScOutGain > GAIN_AMP_M_INF_DB))
+            // Muted bands are excluded from processing, only the IIR crossover
+            // calls the handler for them since it can not skip the band split
+            if (self->vBands[band].bMute)
+                return;
+
+            const uint64_t start        = rmod::clock_ns();
+            lsp_finally { rmod::timing_account(&cb->sTiming, start); };
+
+            // The crossover is shared between input and sidechain: store the band signal
+            // for further processing and pass it to the sidechain processing
+            if (c->bShared)
             {
-                float * const sc            = &c->vSidechain[sample];
-                dsp::fmadd_k3(sc, data, self->fScOutGain, samples);
+                dsp::copy(&cb->vBandData[sample], data, samples);
+                process_sc_band(object, subject, band, data, sample, samples);
+                return;
             }
 
-            // Transform sidechain signal into envelope
-            const float sc_gain         = self->fScGain;
-            uint32_t hold               = cb->nHold;
-            float peak                  = cb->fPeak;
-            float * const dst           = &cb->vEnvelope[sample];
+            apply_band(self, c, band, data, sample, samples);
+        }
+
+        void mb_ringmod_sc::apply_band(mb_ringmod_sc *self, channel_t *c, size_t band, const float *data, size_t sample, size_t samples)
+        {
+            ch_band_t * const cb        = &c->vBands[band];
+            band_t * const b            = &self->vBands[band];
+
+            const float * const env     = (self->nThreading == MT_PIPELINE) ? &cb->vBandData[sample] : &cb->vEnvelope[sample];
+            const bool reduce           = (b->bOn) && (self->bActive);
 
-            for (size_t i=0; i<samples; ++i)
+            // Compute the gain reduction as g = max(0, A + env * B)
+            // cb->vEnvelope contains sidechain envelope signal
+            rmod::band_mix_t m;
+            if (!reduce)
             {
-                float s             = fabsf(data[i] * sc_gain);  // Rectify input
-                if (peak > s)
-                {
-                    // Current rectified sample is below the peak value
-                    if (hold > 0)
-                    {
-                        s                   = peak;             // Hold peak value
-                        --hold;
-                    }
-                    else
-                    {
-                        s                   = peak + (s - peak) * b->fTauRelease;
-                        peak                = s;
-                    }
-                }
-                else
-                {
-                    peak                = s;
-                    hold                = b->nHold;             // Reset hold counter
-                }
-                dst[i]              = s;
+                m.fA                        = GAIN_AMP_0_DB;
+                m.fB                        = 0.0f;
+            }
+            else if (self->bInvert)
+            {
+                m.fA                        = 0.0f;
+                m.fB                        = b->fAmount * b->fGain;
+            }
+            else
+            {
+                m.fA                        = b->fGain;
+                m.fB                        = -b->fAmount * b->fGain;
             }
 
-            // Update parameters
-            cb->nHold           = hold;
-            cb->fPeak           = peak;
+            // Mix signal to input buffer after crossover and mix dry and wet band signal
+            // to the output if band is enabled
+            m.fIn                       = self->fInGain;
+            m.fDry                      = (self->bOutIn) ? self->fInGain * self->fDryGain : 0.0f;
+            m.fWet                      = (self->bOutIn) ? self->fInGain * self->fWetGain : 0.0f;
+
+            const float reduction       = rmod::mix_band(&c->vDataIn[sample], &c->vDataOut[sample], data, env, &m, samples);
+            if (reduce)
+                cb->fReduction              = lsp_min(cb->fReduction, reduction);
+        }
+
+        void mb_ringmod_sc::process_spectrum(void *object, void *subject, const float *fft, size_t rank)
+        {
+            mb_ringmod_sc * const self  = static_cast<mb_ringmod_sc *>(object);
+            rmod::SpectrumTap * const tap = static_cast<rmod::SpectrumTap *>(subject);
+
+            // Same as for the analyzer, nobody looks at the spectra while there is no UI
+            if (self->bUiActive)
+                tap->process(fft, rank);
+        }
+
+        void mb_ringmod_sc::process_sc_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t samples)
+        {
+            mb_ringmod_sc * const self  = static_cast<mb_ringmod_sc *>(object);
+            channel_t * const c         = static_cast<channel_t *>(subject);
+            ch_band_t * const cb        = &c->vBands[band];
+            band_t * const b            = &self->vBands[band];
 
-            // Now push the buffer contents to the ring buffer
-            cb->sEnvDelay.append(dst, samples);
-            if ((!b->bOn) || (!self->bActive))
+            // Muted bands are excluded from processing
+            if (b->bMute)
                 return;
 
-            // Apply latency compensation, lookahead and ducking
-            if (self->nLatency > 0)
-                cb->sEnvDelay.get(dst, samples + self->nLatency, samples);
+            const uint64_t start        = rmod::clock_ns();
+            lsp_finally { rmod::timing_account(&cb->sScTiming, start); };
 
-            if (b->nLatency < self->nLatency)
-            {
-                cb->sEnvDelay.get(self->vBuffer, samples + b->nLatency, samples);
-                dsp::pmax2(dst, self->vBuffer, samples);
-            }
-            if (b->nDuck > self->nLatency)
+            // Need to pass sidechain to output?
+            if ((self->bOutSc) && (self->fScOutGain > GAIN_AMP_M_INF_DB))
             {
-                cb->sEnvDelay.get(self->vBuffer, samples + b->nDuck, samples);
-                dsp::pmax2(dst, self->vBuffer, samples);
+                float * const sc            = &c->vSidechain[sample];
+                dsp::fmadd_k3(sc, data, self->fScOutGain, samples);
             }
+
+            // Store the band signal, it will be transformed into envelope after the crossover
+            // has finished processing for all bands
+            dsp::copy(&cb->vEnvelope[sample], data, samples);
         }
 
         void mb_ringmod_sc::process_signal(size_t samples)
         {
-            float *analyze[6];
-
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
@@ -1209,22 +1859,72 @@ namespace lsp
                 dsp::fill_zero(c->vDataOut, samples);
 
                 // Apply latency compensation
-                c->sInDelay.process(c->vTmpIn, c->vInPtr, samples);
+                c->vInDelayPtr      = c->sInDelay.process(c->vInPtr, samples);
+            }
 
-                // Process wet signal
-                if (nMode == MODE_IIR)
-                    c->sCrossover.process(c->vTmpIn, samples);
-                else
-                    c->sFFTCrossover.process(c->vTmpIn, samples);
+            // Linear-phase crossover processes all channels at once
+            if ((nMode != MODE_IIR) && (!vChannels[0].bShared))
+                process_crossover(vChannels[0].vInDelayPtr, (nChannels > 1) ? vChannels[1].vInDelayPtr : NULL, samples);
+
+            // Process channels, the right channel is processed by the worker thread
+            // if parallel processing is enabled
+            if (submit_right_channel(channel_signal_task, samples))
+            {
+                process_channel_signal(&vChannels[0], samples);
+                sWorker.wait();
+            }
+            else
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    process_channel_signal(&vChannels[i], samples);
+            }
+        }
 
-                // Add sidechain to output
-                if (bOutSc)
+        void mb_ringmod_sc::process_channel_signal(channel_t *c, size_t samples)
+        {
+            // Process wet signal
+            if (c->bShared)
+            {
+                // Band signals have been already computed by the crossover
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
                 {
-                    c->sScDelay.process(c->vSidechain, c->vSidechain, samples);
-                    dsp::add2(c->vDataOut, c->vSidechain, samples);
+                    if ((vBands[j].bActive) && (!vBands[j].bMute))
+                        apply_band(this, c, j, c->vBands[j].vBandData, 0, samples);
                 }
-                else
-                    c->sScDelay.append(c->vSidechain, samples);
+            }
+            else if (nMode == MODE_IIR)
+                c->sCrossover.process(c->vInDelayPtr, samples);
+
+            // In pipelined mode the sidechain signal is not ready yet, the output
+            // is produced after the sidechain processing has finished
+            if (nThreading != MT_PIPELINE)
+                process_channel_output(c, samples);
+        }
+
+        void mb_ringmod_sc::process_channel_output(channel_t *c, size_t samples)
+        {
+            // Add sidechain to output
+            if (bOutSc)
+                dsp::add2(c->vDataOut, c->sScDelay.process(c->vSidechain, samples), samples);
+            else
+                c->sScDelay.append(c->vSidechain, samples);
+
+            // Now c->vDataOut contains processed signal, apply bypass
+            const float *dry    = c->sDryDelay.process(c->vInDelayPtr, samples);
+            c->sBypass.process(c->vOutPtr, dry, c->vDataOut, samples);
+        }
+
+        void mb_ringmod_sc::process_analysis(size_t samples)
+        {
+            // Nobody looks at the meters and spectra while there is no UI
+            if (!bUiActive)
+                return;
+
+            float *analyze[6];
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
 
                 // Store buffers for analysis
                 float **dst     = &analyze[i*MTR_TOTAL];
@@ -1238,18 +1938,43 @@ namespace lsp
                     const float pk  = dsp::abs_max(dst[j], samples);
                     c->vMeters[j]   = lsp_max(v, (j == MTR_IN) ? pk * fInGain : pk);
                 }
-
-                // Now c->vDataOut contains processed signal, apply bypass
-                c->sDryDelay.process(c->vTmpIn, c->vTmpIn, samples);
-                c->sBypass.process(c->vOutPtr, c->vTmpIn, c->vDataOut, samples);
             }
 
             // Perform FFT analysis
             sAnalyzer.process(analyze, samples);
         }
 
+        void mb_ringmod_sc::commit_timings()
+        {
+            // Compute the duration of the timing window in nanoseconds
+            const double window = (fSampleRate > 0) ? (nTimingSamples * 1e+9) / fSampleRate : 0.0;
+            nTimingSamples      = 0;
+
+            for (size_t i=0; i<STG_TOTAL; ++i)
+                rmod::timing_commit(&vTiming[i], window);
+            rmod::timing_commit(&sTiming, window);
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t * const c = &vChannels[i];
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
+                {
+                    ch_band_t * const cb    = &c->vBands[j];
+                    rmod::timing_commit(&cb->sScTiming, window);
+                    rmod::timing_commit(&cb->sTiming, window);
+                }
+            }
+
+            if (pDspLoad != NULL)
+                pDspLoad->set_value(lsp_limit(sTiming.fLoad, meta::mb_ringmod_sc::DSP_LOAD_MIN, meta::mb_ringmod_sc::DSP_LOAD_MAX));
+        }
+
         void mb_ringmod_sc::process(size_t samples)
         {
+            // Decaying envelopes and filter states should never reach the denormal range
+            rmod::DenormalGuard guard;
+            const uint64_t start    = rmod::clock_ns();
+
             // Prepare audio channels
             for (size_t i=0; i<nChannels; ++i)
             {
@@ -1274,33 +1999,159 @@ namespace lsp
                 }
             }
 
-            // Process data
-            for (size_t offset = 0; offset < samples;)
+            // Apply the state of threads changed by the executor
+            sync_threads();
+
+            // Process data, skip the processing if the plugin is idle
+            if (detect_silence(samples))
+                process_idle(samples);
+            else
             {
-                const size_t to_process     = lsp_min(samples - offset, BUFFER_SIZE);
+                for (size_t offset = 0; offset < samples;)
+                {
+                    const size_t to_process     = lsp_min(samples - offset, size_t(nSliceSize));
 
-                // Do processing
-                premix_channels(to_process);
-                process_sidechain_type(to_process);
-                process_sidechain_envelope(to_process);
-                process_signal(to_process);
+                    // Do processing
+                    uint64_t t                  = rmod::clock_ns();
+                    premix_channels(to_process);
+                    t                           = rmod::timing_account(&vTiming[STG_PREMIX], t);
+                    if (nThreading == MT_PIPELINE)
+                    {
+                        // Sidechain and signal are processed simultaneously
+                        process_pipelined(to_process);
+                        t                           = rmod::timing_account(&vTiming[STG_SIGNAL], t);
+                    }
+                    else
+                    {
+                        process_sidechain_envelope(to_process);
+                        t                           = rmod::timing_account(&vTiming[STG_SC_ENVELOPE], t);
+                        process_signal(to_process);
+                        t                           = rmod::timing_account(&vTiming[STG_SIGNAL], t);
+                    }
+                    process_analysis(to_process);
+                    rmod::timing_account(&vTiming[STG_ANALYSIS], t);
 
-                // Updte offset
-                offset                     += to_process;
+                    // Updte offset
+                    offset                     += to_process;
+                }
             }
 
             // Referesh update counter
+            const uint64_t t        = rmod::clock_ns();
             sCounter.submit(samples);
+            nTimingSamples         += samples;
 
             // Output meters
             output_meters();
 
             // Output meshes
+            const bool fired        = sCounter.fired();
             update_meshes();
             output_meshes();
+
+            // Account time and publish DSP load once per refresh window
+            rmod::timing_account(&vTiming[STG_MESHES], t);
+            rmod::timing_account(&sTiming, start);
+            if (fired)
+                commit_timings();
         }
 
 
+        bool mb_ringmod_sc::detect_silence(size_t samples)
+        {
+            // Check that all inputs contain digital silence
+            bool silent         = true;
+            for (size_t i=0; (silent) && (i<nChannels); ++i)
+            {
+                channel_t * const c = &vChannels[i];
+
+                if (dsp::abs_max(c->vIn, samples) > 0.0f)
+                    silent              = false;
+                else if ((c->vSc != NULL) && (dsp::abs_max(c->vSc, samples) > 0.0f))
+                    silent              = false;
+                else if ((c->vLink != NULL) && (dsp::abs_max(c->vLink, samples) > 0.0f))
+                    silent              = false;
+            }
+
+            // The state has been flushed on entering the idle state,
+            // so the processing can be resumed immediately
+            if (!silent)
+            {
+                nIdleSamples        = 0;
+                bIdle               = false;
+                return false;
+            }
+            if (bIdle)
+                return true;
+
+            // Wait until the delay lines and crossovers have been filled with silence
+            nIdleSamples        = lsp_min(nIdleSamples + samples, nIdleDelay);
+            if (nIdleSamples < nIdleDelay)
+                return false;
+
+            // Wait until all envelopes have decayed
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t * const c = &vChannels[i];
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
+                {
+                    if ((vBands[j].bActive) && (!vBands[j].bMute) && (c->vBands[j].fPeak >= IDLE_THRESHOLD))
+                        return false;
+                }
+            }
+
+            // Enter the idle state and flush the remaining state to have clean start
+            // when the signal returns. IIR filters have decayed during the hold time.
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t * const c = &vChannels[i];
+
+                c->sInDelay.clear();
+                c->sScDelay.clear();
+                c->sDryDelay.clear();
+
+                for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
+                {
+                    ch_band_t * const cb    = &c->vBands[j];
+
+                    cb->sEnvDelay.clear();
+                    cb->sEnvMax.clear();
+                    cb->fPeak               = 0.0f;
+                    cb->nHold               = 0;
+                }
+            }
+            sFFTCrossover.clear();
+            sFFTScCrossover.clear();
+            sFIRCrossover.clear();
+            sFIRScCrossover.clear();
+            sInTap.clear();
+            sScTap.clear();
+
+            bIdle               = true;
+            return true;
+        }
+
+        void mb_ringmod_sc::process_idle(size_t samples)
+        {
+            const uint64_t t    = rmod::clock_ns();
+
+            // Only the bypass switch needs to be advanced, the output is silent
+            for (size_t offset = 0; offset < samples;)
+            {
+                const size_t to_process     = lsp_min(samples - offset, BUFFER_SIZE);
+
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t * const c = &vChannels[i];
+                    c->sBypass.process(&c->vOut[offset], vEmptyBuffer, vEmptyBuffer, to_process);
+                }
+
+                offset                     += to_process;
+            }
+
+            rmod::timing_account(&vTiming[STG_SIGNAL], t);
+        }
+
         void mb_ringmod_sc::output_meters()
         {
             for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
@@ -1330,6 +2181,13 @@ namespace lsp
                 return;
             sCounter.commit();
 
+            // Without UI the gain chart is needed only for the inline display. Keep it updated
+            // while the host draws the inline display, the host does not draw it on the headless
+            // systems, so the update stops after the first request for redraw
+            if ((!bUiActive) && (!bDisplayDrawn))
+                return;
+            bDisplayDrawn       = false;
+
             // Form gain reduction chart for each buffer
             for (size_t i=0; i<nChannels; ++i)
             {
@@ -1364,6 +2222,10 @@ namespace lsp
 
         void mb_ringmod_sc::output_meshes()
         {
+            // Meshes are synchronized again when the UI is activated
+            if (!bUiActive)
+                return;
+
             // Output filter mesh
             plug::mesh_t *mesh      = (pFilterMesh != NULL) ? pFilterMesh->buffer<plug::mesh_t>() : NULL;
             if ((bSyncFilters) && (mesh != NULL) && (mesh->isEmpty()))
@@ -1414,6 +2276,22 @@ namespace lsp
                 v[0]                = SPEC_FREQ_MAX * 2.0f;
                 v[1]                = SPEC_FREQ_MAX * 2.0f;
 
+                // Acquire the spectra most recently published by the analyzer thread
+                sAnalyzer.sync();
+
+                // The signal assembled from bands has the spectrum of the crossover input
+                // multiplied by the sum of transfer functions of processed bands
+                if (nMode == MODE_SPM)
+                {
+                    dsp::fill_zero(vBuffer, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                    for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+                    {
+                        const band_t * const b  = &vBands[i];
+                        if ((b->bActive) && (!b->bMute))
+                            dsp::add2(vBuffer, b->vTr, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                    }
+                }
+
                 for (size_t i=0; i<nChannels; ++i)
                 {
                     channel_t * const c = &vChannels[i];
@@ -1431,10 +2309,14 @@ namespace lsp
                     for (size_t j=0; j<MTR_TOTAL; ++j)
                     {
                         const float an_id   = i*MTR_TOTAL + j;
+                        const bool tap      = (nMode == MODE_SPM) && (j != MTR_OUT);
                         v                   = mesh->pvData[index++];
-                        if ((c->bFft[j]) && (sAnalyzer.channel_active(an_id)))
+                        if ((c->bFft[j]) && ((tap) || (sAnalyzer.channel_active(an_id))))
                         {
-                            sAnalyzer.get_spectrum(an_id, &v[2], vIndexes, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                            if (tap)
+                                get_tap_spectrum(i, j, vBuffer, &v[2]);
+                            else
+                                sAnalyzer.get_spectrum(an_id, &v[2]);
                             if (j == MTR_IN)
                                 dsp::mul_k2(&v[2], fInGain, meta::mb_ringmod_sc::FFT_MESH_POINTS);
                         }
@@ -1454,8 +2336,39 @@ namespace lsp
             }
         }
 
+        void mb_ringmod_sc::get_tap_spectrum(size_t channel, size_t meter, const float *tr, float *dst) const
+        {
+            const rmod::SpectrumTap *tap;
+            float gain;
+
+            if (meter == MTR_IN)
+            {
+                tap                 = &sInTap;
+                gain                = fInGain;
+            }
+            else
+            {
+                tap                 = (vChannels[0].bShared) ? &sInTap : &sScTap;
+                gain                = (bOutSc) ? fScOutGain : 0.0f;
+                if (bScMono)
+                    channel             = 0;
+            }
+
+            if ((!tap->active()) || (gain <= GAIN_AMP_M_INF_DB))
+            {
+                dsp::fill_zero(dst, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+                return;
+            }
+
+            tap->get_spectrum(channel, dst);
+            dsp::mul2(dst, tr, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+            dsp::mul_k2(dst, gain, meta::mb_ringmod_sc::FFT_MESH_POINTS);
+        }
+
         bool mb_ringmod_sc::inline_display(plug::ICanvas *cv, size_t width, size_t height)
         {
+            bDisplayDrawn       = true;
+
             // Check proportions
             if (height > (M_RGOLD_RATIO * width))
                 height  = M_RGOLD_RATIO * width;
@@ -1568,8 +2481,6 @@ namespace lsp
                     v->write_object("sDryDelay", &c->sDryDelay);
                     v->write_object("sCrossover", &c->sCrossover);
                     v->write_object("sScCrossover", &c->sScCrossover);
-                    v->write_object("sFFTCrossover", &c->sFFTCrossover);
-                    v->write_object("sFFTScCrossover", &c->sFFTScCrossover);
 
                     v->begin_array("vBands", c->vBands, meta::mb_ringmod_sc::BANDS_MAX);
                     for (size_t j=0; j<meta::mb_ringmod_sc::BANDS_MAX; ++j)
@@ -1579,11 +2490,15 @@ namespace lsp
                         v->begin_object(cb, sizeof(ch_band_t));
                         {
                             v->write_object("sEnvDelay", &cb->sEnvDelay);
+                            v->write_object("sEnvMax", &cb->sEnvMax);
 
                             v->write("vEnvelope", cb->vEnvelope);
+                            v->write("vBandData", cb->vBandData);
                             v->write("nHold", cb->nHold);
                             v->write("fPeak", cb->fPeak);
                             v->write("fReduction", cb->fReduction);
+                            dump_timing(v, "sScTiming", &cb->sScTiming);
+                            dump_timing(v, "sTiming", &cb->sTiming);
                             v->write("pReduction", cb->pReduction);
                         }
                         v->end_object();
@@ -1597,11 +2512,10 @@ namespace lsp
 
                     v->write("vInPtr", c->vInPtr);
                     v->write("vScPtr", c->vScPtr);
-                    v->write("vLinkPtr", c->vLinkPtr);
                     v->write("vOutPtr", c->vOutPtr);
+                    v->write("vInDelayPtr", c->vInDelayPtr);
 
                     v->write("vTmpIn", c->vTmpIn);
-                    v->write("vTmpLink", c->vTmpLink);
                     v->write("vTmpSc", c->vTmpSc);
 
                     v->write("vDataIn", c->vDataIn);
@@ -1613,6 +2527,7 @@ namespace lsp
 
                     v->writev("vMeters", c->vMeters, MTR_TOTAL);
                     v->writev("bFft", c->bFft, MTR_TOTAL);
+                    v->write("bShared", c->bShared);
 
                     v->write("pIn", c->pIn);
                     v->write("pOut", c->pOut);
@@ -1626,7 +2541,14 @@ namespace lsp
             v->end_array();
 
             v->write_object("sAnalyzer", &sAnalyzer);
+            v->write("pExecutor", pExecutor);
             v->write_object("sCounter", &sCounter);
+            v->write_object("sFFTCrossover", &sFFTCrossover);
+            v->write_object("sFFTScCrossover", &sFFTScCrossover);
+            v->write_object("sInTap", &sInTap);
+            v->write_object("sScTap", &sScTap);
+            v->write_object("sFIRCrossover", &sFIRCrossover);
+            v->write_object("sFIRScCrossover", &sFIRScCrossover);
 
             v->begin_array("vSplits", vSplits, meta::mb_ringmod_sc::BANDS_MAX - 1);
             for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX - 1; ++i)
@@ -1647,6 +2569,7 @@ namespace lsp
                 v->write("fFreqStart", b->fFreqStart);
                 v->write("fFreqEnd", b->fFreqEnd);
                 v->write("fTauRelease", b->fTauRelease);
+                v->write("fRelease", b->fRelease);
                 v->write("fAmount", b->fAmount);
                 v->write("fGain", b->fGain);
                 v->write("nHold", b->nHold);
@@ -1656,6 +2579,7 @@ namespace lsp
                 v->write("bActive", b->bActive);
                 v->write("bOn", b->bOn);
                 v->write("bMute", b->bMute);
+                v->write("bUpdChart", b->bUpdChart);
 
                 v->write("pSolo", b->pSolo);
                 v->write("pMute", b->pMute);
@@ -1674,7 +2598,6 @@ namespace lsp
             v->write("vBuffer", vBuffer);
             v->write("vEmptyBuffer", vEmptyBuffer);
             v->write("vFreqs", vFreqs);
-            v->write("vIndexes", vIndexes);
 
             v->begin_object("sPremix", &sPremix, sizeof(premix_t));
             {
@@ -1691,12 +2614,32 @@ namespace lsp
                 v->write("pLinkToSc", sPremix.pLinkToSc);
                 v->write("pScToIn", sPremix.pScToIn);
                 v->write("pScToLink", sPremix.pScToLink);
+
+                v->writev("vInMix", sPremix.vInMix[0].vGain[0], 2 * 2 * MIX_TOTAL);
+                v->writev("vScMix", sPremix.vScMix[0].vGain[0], 2 * 2 * MIX_TOTAL);
+                v->write("nScPost", sPremix.nScPost);
+                v->write("bScShared", sPremix.bScShared);
             }
+            v->end_object();
+
+            v->begin_array("vTiming", vTiming, STG_TOTAL);
+            for (size_t i=0; i<STG_TOTAL; ++i)
+                dump_timing(v, NULL, &vTiming[i]);
+            v->end_array();
+            dump_timing(v, "sTiming", &sTiming);
+            v->write("nTimingSamples", nTimingSamples);
+            v->write("nIdleSamples", nIdleSamples);
+            v->write("nIdleDelay", nIdleDelay);
+            v->write("nSliceSize", nSliceSize);
+            v->write("nSliceHint", nSliceHint);
 
             v->write("nType", nType);
             v->write("nSource", nSource);
             v->write("nMode", nMode);
+            v->write("nSlope", nSlope);
+            v->write("nPartRank", nPartRank);
             v->write("nLatency", nLatency);
+            v->write("nThreading", nThreading);
             v->write("fInGain", fInGain);
             v->write("fScGain", fScGain);
             v->write("fDryGain", fDryGain);
@@ -1709,6 +2652,12 @@ namespace lsp
             v->write("bInvert", bInvert);
             v->write("bOutIn", bOutIn);
             v->write("bOutSc", bOutSc);
+            v->write("bScMono", bScMono);
+            v->write("bIdle", bIdle);
+            v->write("bWorker", bWorker);
+            v->write("bAnalyzer", bAnalyzer);
+            v->write("bUiActive", bUiActive);
+            v->write("bDisplayDrawn", bDisplayDrawn);
 
             v->write("pIDisplay", pIDisplay);
 
@@ -1723,6 +2672,8 @@ namespace lsp
             v->write("pType", pType);
             v->write("pMode", pMode);
             v->write("pSlope", pSlope);
+            v->write("pPartition", pPartition);
+            v->write("pResolution", pResolution);
             v->write("pDry", pDry);
             v->write("pWet", pWet);
             v->write("pDryWet", pDryWet);
@@ -1731,7 +2682,9 @@ namespace lsp
             v->write("pShift", pShift);
             v->write("pFilterMesh", pFilterMesh);
             v->write("pMeterMesh", pMeterMesh);
+            v->write("pDspLoad", pDspLoad);
             v->write("pSource", pSource);
+            v->write("pThreading", pThreading);
 
             v->write("pData", pData);
         }
@@ -0,0 +1,501 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/rmod/AsyncAnalyzer.h>
+#include <private/rmod/DenormalGuard.h>
+
+#include <math.h>
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+#endif /* PLATFORM_WINDOWS */
+
+#define ANALYZER_BUFFER_TIME    0.1f
+#define ANALYZER_CHANNELS_MAX   32
+#define SPECTRUM_FRESH          0x4
+#define SPECTRUM_INDEX          0x3
+
+namespace lsp
+{
+    namespace rmod
+    {
+        static inline void lower_priority()
+        {
+            // The thread should not inherit the real-time priority of the thread which has started it
+        #ifdef PLATFORM_WINDOWS
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+        #else
+            struct sched_param param;
+            param.sched_priority    = 0;
+            pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+        #endif /* PLATFORM_WINDOWS */
+        }
+
+        AsyncAnalyzer::AsyncAnalyzer()
+        {
+            pThread         = NULL;
+            construct();
+        }
+
+        AsyncAnalyzer::~AsyncAnalyzer()
+        {
+            destroy();
+        }
+
+        void AsyncAnalyzer::construct()
+        {
+            nChannels       = 0;
+            nRank           = 0;
+            nPoints         = 0;
+            nCapacity       = 0;
+            fRate           = 0.0f;
+            fStart          = 0.0f;
+            fStop           = 0.0f;
+            nFront          = 0;
+            nBack           = 2;
+            nPeriod         = 0;
+            nCountdown      = 0;
+            nSignal         = 0;
+            nPending        = 0;
+
+            nSampleRate     = 0;
+            nEnabled        = 0;
+            nWindow         = 0;
+            nEnvelope       = 0;
+            fReactivity     = 0.0f;
+            fShift          = 1.0f;
+            bActive         = false;
+            bExit           = false;
+
+            atomic_store(&nHead, 0);
+            atomic_store(&nTail, 0);
+            atomic_store(&nLatest, 1);
+            atomic_store(&nVersion, 0);
+            sWakeup.reset();
+
+            vRing           = NULL;
+            for (size_t i=0; i<3; ++i)
+                vSpectrum[i]    = NULL;
+            vChannels       = NULL;
+            vIndexes        = NULL;
+            pData           = NULL;
+        }
+
+        void AsyncAnalyzer::destroy()
+        {
+            stop();
+            sAnalyzer.destroy();
+            free_aligned(pData);
+            construct();
+        }
+
+        bool AsyncAnalyzer::init(size_t channels, size_t rank, size_t max_sr, float rate,
+            size_t points, float freq_min, float freq_max)
+        {
+            destroy();
+            if ((channels <= 0) || (channels > ANALYZER_CHANNELS_MAX) || (points <= 0))
+                return false;
+
+            if (!sAnalyzer.init(channels, rank, max_sr, rate))
+                return false;
+            sAnalyzer.set_rank(rank);
+            sAnalyzer.set_rate(rate);
+            sAnalyzer.set_activity(false);
+
+            // The ring buffer should keep the data for several wake-ups of the analyzer thread
+            size_t capacity             = 0x100;
+            while (capacity < max_sr * ANALYZER_BUFFER_TIME)
+                capacity                  <<= 1;
+
+            const size_t szof_ring      = align_size(sizeof(float) * capacity * channels, 64);
+            const size_t szof_spectrum  = align_size(sizeof(float) * points * channels, 64);
+            const size_t szof_channels  = align_size(sizeof(float *) * channels, 64);
+            const size_t szof_indexes   = align_size(sizeof(uint32_t) * points, 64);
+            const size_t to_alloc       = szof_ring + szof_spectrum * 3 + szof_channels + szof_indexes;
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, 64);
+            if (ptr == NULL)
+                return false;
+
+            nChannels                   = channels;
+            nRank                       = rank;
+            nPoints                     = points;
+            nCapacity                   = capacity;
+            fRate                       = rate;
+            fStart                      = freq_min;
+            fStop                       = freq_max;
+
+            vRing                       = advance_ptr_bytes<float>(ptr, szof_ring);
+            for (size_t i=0; i<3; ++i)
+            {
+                vSpectrum[i]                = advance_ptr_bytes<float>(ptr, szof_spectrum);
+                dsp::fill_zero(vSpectrum[i], points * channels);
+            }
+            vChannels                   = advance_ptr_bytes<float *>(ptr, szof_channels);
+            vIndexes                    = advance_ptr_bytes<uint32_t>(ptr, szof_indexes);
+
+            dsp::fill_zero(vRing, capacity * channels);
+            for (size_t i=0; i<points; ++i)
+                vIndexes[i]                 = 0;
+            update_signal();
+
+            return true;
+        }
+
+        status_t AsyncAnalyzer::thread_proc(void *arg)
+        {
+            static_cast<AsyncAnalyzer *>(arg)->run();
+            return STATUS_OK;
+        }
+
+        bool AsyncAnalyzer::start()
+        {
+            if (pThread != NULL)
+                return true;
+            if (pData == NULL)
+                return false;
+
+            bExit           = false;
+
+            ipc::Thread *thread = new ipc::Thread(thread_proc, this);
+            if (thread == NULL)
+                return false;
+            if (thread->start() != STATUS_OK)
+            {
+                delete thread;
+                return false;
+            }
+
+            pThread         = thread;
+            return true;
+        }
+
+        void AsyncAnalyzer::stop()
+        {
+            if (pThread == NULL)
+                return;
+
+            bExit           = true;
+            sWakeup.post();
+            pThread->join();
+
+            delete pThread;
+            pThread         = NULL;
+        }
+
+        void AsyncAnalyzer::run()
+        {
+            DenormalGuard guard;
+            lower_priority();
+
+            // Settings are applied with the first wake-up
+            atomic_t version    = atomic_load(&nVersion) - 1;
+
+            while (true)
+            {
+                // Block until the audio thread collects the data or changes the settings
+                sWakeup.wait(0);
+                if (bExit)
+                    break;
+
+                const atomic_t actual   = atomic_load(&nVersion);
+                if (actual != version)
+                {
+                    version             = actual;
+                    apply_settings();
+                }
+
+                analyze();
+            }
+        }
+
+        void AsyncAnalyzer::apply_settings()
+        {
+            const size_t sr         = nSampleRate;
+            const uint32_t enabled  = nEnabled;
+
+            if (sr > 0)
+                sAnalyzer.set_sample_rate(sr);
+            for (size_t i=0; i<nChannels; ++i)
+                sAnalyzer.enable_channel(i, enabled & (uint32_t(1) << i));
+            sAnalyzer.set_window(nWindow);
+            sAnalyzer.set_envelope(nEnvelope);
+            sAnalyzer.set_reactivity(fReactivity);
+            sAnalyzer.set_shift(fShift);
+            sAnalyzer.set_activity(bActive);
+
+            if (sAnalyzer.needs_reconfiguration())
+                sAnalyzer.reconfigure();
+
+            // Compute the position of each mesh point in the spectrum
+            const size_t fft_csize  = (size_t(1) << nRank) >> 1;
+            const float scale       = (sr > 0) ? float(size_t(1) << nRank) / float(sr) : 0.0f;
+            const float norm        = (nPoints > 1) ? logf(fStop / fStart) / (nPoints - 1) : 0.0f;
+            for (size_t i=0; i<nPoints; ++i)
+            {
+                const size_t ix         = scale * fStart * expf(i * norm);
+                vIndexes[i]             = lsp_min(ix, fft_csize);
+            }
+
+            nPeriod                 = (fRate > 0.0f) ? size_t(sr / fRate) : 0;
+        }
+
+        void AsyncAnalyzer::analyze()
+        {
+            uint32_t tail           = uint32_t(atomic_load(&nTail));
+            const uint32_t head     = uint32_t(atomic_load(&nHead));
+            if (tail == head)
+                return;
+
+            do
+            {
+                // Feed the contiguous part of the ring buffer to the analyzer
+                const size_t offset     = tail & (nCapacity - 1);
+                const size_t count      = lsp_min(size_t(head - tail), nCapacity - offset);
+                for (size_t i=0; i<nChannels; ++i)
+                    vChannels[i]            = &vRing[i * nCapacity + offset];
+
+                sAnalyzer.process(vChannels, count);
+                tail                   += count;
+                atomic_store(&nTail, atomic_t(tail));
+
+                nCountdown              = (nCountdown > count) ? nCountdown - count : 0;
+            } while (tail != head);
+
+            // Publish the spectra at the refresh rate
+            if (nCountdown <= 0)
+            {
+                publish();
+                nCountdown              = nPeriod;
+            }
+        }
+
+        void AsyncAnalyzer::publish()
+        {
+            float * const dst       = vSpectrum[nBack];
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                float * const v         = &dst[i * nPoints];
+                if (sAnalyzer.channel_active(i))
+                    sAnalyzer.get_spectrum(i, v, vIndexes, nPoints);
+                else
+                    dsp::fill_zero(v, nPoints);
+            }
+
+            // Exchange the back buffer with the latest one and mark it as fresh
+            const atomic_t prev     = atomic_swap(&nLatest, atomic_t(nBack | SPECTRUM_FRESH));
+            nBack                   = prev & SPECTRUM_INDEX;
+        }
+
+        void AsyncAnalyzer::mark_changed()
+        {
+            // The analyzer thread should apply the settings even if there is no data to analyze
+            atomic_add(&nVersion, 1);
+            sWakeup.post();
+        }
+
+        void AsyncAnalyzer::update_signal()
+        {
+            // Wake up the analyzer thread once per publication but keep the room in the ring buffer
+            const size_t period     = (fRate > 0.0f) ? size_t(nSampleRate / fRate) : 0;
+            nSignal                 = lsp_limit(period, size_t(1), nCapacity >> 1);
+        }
+
+        void AsyncAnalyzer::set_sample_rate(size_t sr)
+        {
+            if (nSampleRate == sr)
+                return;
+            nSampleRate     = sr;
+            update_signal();
+            mark_changed();
+        }
+
+        void AsyncAnalyzer::enable_channel(size_t channel, bool enable)
+        {
+            if (channel >= nChannels)
+                return;
+
+            const uint32_t mask     = uint32_t(1) << channel;
+            const uint32_t value    = (enable) ? nEnabled | mask : nEnabled & (~mask);
+            if (nEnabled == value)
+                return;
+            nEnabled        = value;
+            mark_changed();
+        }
+
+        bool AsyncAnalyzer::channel_active(size_t channel) const
+        {
+            if ((channel >= nChannels) || (!bActive))
+                return false;
+            return nEnabled & (uint32_t(1) << channel);
+        }
+
+        void AsyncAnalyzer::set_activity(bool active)
+        {
+            if (bActive == active)
+                return;
+            bActive         = active;
+            nPending        = 0;
+            mark_changed();
+        }
+
+        void AsyncAnalyzer::set_reactivity(float reactivity)
+        {
+            if (fReactivity == reactivity)
+                return;
+            fReactivity     = reactivity;
+            mark_changed();
+        }
+
+        void AsyncAnalyzer::set_shift(float shift)
+        {
+            if (fShift == shift)
+                return;
+            fShift          = shift;
+            mark_changed();
+        }
+
+        void AsyncAnalyzer::set_window(size_t window)
+        {
+            if (nWindow == window)
+                return;
+            nWindow         = window;
+            mark_changed();
+        }
+
+        void AsyncAnalyzer::set_envelope(size_t envelope)
+        {
+            if (nEnvelope == envelope)
+                return;
+            nEnvelope       = envelope;
+            mark_changed();
+        }
+
+        void AsyncAnalyzer::process(const float * const *in, size_t samples)
+        {
+            // Nothing is posted while the analysis is inactive, so the analyzer thread stays blocked
+            if ((vRing == NULL) || (!bActive))
+                return;
+
+            // Samples that do not fit into the ring buffer are dropped, this affects only the analysis
+            const uint32_t head     = uint32_t(atomic_load(&nHead));
+            const uint32_t tail     = uint32_t(atomic_load(&nTail));
+            const size_t count      = lsp_min(samples, nCapacity - size_t(head - tail));
+            if (count <= 0)
+                return;
+
+            const size_t offset     = head & (nCapacity - 1);
+            const size_t part       = lsp_min(count, nCapacity - offset);
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                if (!(nEnabled & (uint32_t(1) << i)))
+                    continue;
+
+                float * const ring      = &vRing[i * nCapacity];
+                dsp::copy(&ring[offset], in[i], part);
+                if (count > part)
+                    dsp::copy(ring, &in[i][part], count - part);
+            }
+
+            atomic_store(&nHead, atomic_t(head + count));
+
+            // Wake up the analyzer thread when enough data has been collected
+            nPending               += count;
+            if (nPending >= nSignal)
+            {
+                nPending                = 0;
+                sWakeup.post();
+            }
+        }
+
+        void AsyncAnalyzer::get_frequencies(float *frq) const
+        {
+            const float norm        = (nPoints > 1) ? logf(fStop / fStart) / (nPoints - 1) : 0.0f;
+            for (size_t i=0; i<nPoints; ++i)
+                frq[i]                  = fStart * expf(i * norm);
+        }
+
+        bool AsyncAnalyzer::sync()
+        {
+            if (!(atomic_load(&nLatest) & SPECTRUM_FRESH))
+                return false;
+
+            const atomic_t prev     = atomic_swap(&nLatest, atomic_t(nFront));
+            nFront                  = prev & SPECTRUM_INDEX;
+            return true;
+        }
+
+        void AsyncAnalyzer::get_spectrum(size_t channel, float *dst) const
+        {
+            if ((channel < nChannels) && (vSpectrum[nFront] != NULL))
+                dsp::copy(dst, &vSpectrum[nFront][channel * nPoints], nPoints);
+            else
+                dsp::fill_zero(dst, nPoints);
+        }
+
+        void AsyncAnalyzer::dump(dspu::IStateDumper *v) const
+        {
+            v->write_object("sAnalyzer", &sAnalyzer);
+            v->write("nChannels", nChannels);
+            v->write("nRank", nRank);
+            v->write("nPoints", nPoints);
+            v->write("nCapacity", nCapacity);
+            v->write("fRate", fRate);
+            v->write("fStart", fStart);
+            v->write("fStop", fStop);
+            v->write("nFront", nFront);
+            v->write("nBack", nBack);
+            v->write("nPeriod", nPeriod);
+            v->write("nCountdown", nCountdown);
+            v->write("nSignal", nSignal);
+            v->write("nPending", nPending);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nEnabled", nEnabled);
+            v->write("nWindow", nWindow);
+            v->write("nEnvelope", nEnvelope);
+            v->write("fReactivity", fReactivity);
+            v->write("fShift", fShift);
+            v->write("bActive", bActive);
+            v->write("bExit", bExit);
+            v->write("nHead", nHead);
+            v->write("nTail", nTail);
+            v->write("nLatest", nLatest);
+            v->write("nVersion", nVersion);
+            v->write("pThread", pThread);
+            v->write("vRing", vRing);
+            v->begin_array("vSpectrum", vSpectrum, 3);
+            for (size_t i=0; i<3; ++i)
+                v->write(vSpectrum[i]);
+            v->end_array();
+            v->write("vChannels", vChannels);
+            v->write("vIndexes", vIndexes);
+            v->write("pData", pData);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/rmod/MirrorBuffer.h>
+
+#ifdef PLATFORM_LINUX
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif /* PLATFORM_LINUX */
+
+namespace lsp
+{
+    namespace rmod
+    {
+        MirrorBuffer::MirrorBuffer()
+        {
+            construct();
+        }
+
+        MirrorBuffer::~MirrorBuffer()
+        {
+            destroy();
+        }
+
+        void MirrorBuffer::construct()
+        {
+            nCapacity       = 0;
+            nHead           = 0;
+            nDelay          = 0;
+            nMapSize        = 0;
+            vData           = NULL;
+            pData           = NULL;
+        }
+
+        void MirrorBuffer::destroy()
+        {
+        #ifdef PLATFORM_LINUX
+            if (nMapSize > 0)
+                munmap(vData, nMapSize * 2);
+        #endif /* PLATFORM_LINUX */
+            free_aligned(pData);
+
+            const size_t delay  = nDelay;
+            construct();
+            nDelay          = delay;
+        }
+
+        bool MirrorBuffer::map_mirrored(size_t capacity)
+        {
+        #ifdef PLATFORM_LINUX
+            const long page     = sysconf(_SC_PAGESIZE);
+            if (page <= 0)
+                return false;
+            const size_t bytes  = align_size(capacity * sizeof(float), size_t(page));
+
+            // Create the memory file of the required size
+            const int fd        = int(syscall(SYS_memfd_create, "rmod-mirror", 1u /* MFD_CLOEXEC */));
+            if (fd < 0)
+                return false;
+            lsp_finally { close(fd); };
+            if (ftruncate(fd, bytes) != 0)
+                return false;
+
+            // Reserve the address space and map the file twice into it
+            uint8_t *base       = static_cast<uint8_t *>(mmap(NULL, bytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            if (base == MAP_FAILED)
+                return false;
+
+            for (size_t i=0; i<2; ++i)
+            {
+                if (mmap(&base[bytes * i], bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+                {
+                    munmap(base, bytes * 2);
+                    return false;
+                }
+            }
+
+            nCapacity           = bytes / sizeof(float);
+            nMapSize            = bytes;
+            vData               = reinterpret_cast<float *>(base);
+            return true;
+        #else
+            return false;
+        #endif /* PLATFORM_LINUX */
+        }
+
+        bool MirrorBuffer::init(size_t capacity)
+        {
+            destroy();
+            capacity        = lsp_max(capacity, size_t(1));
+
+            if (!map_mirrored(capacity))
+            {
+                // Fall back to the buffer of double size with duplicated writes
+                float *ptr          = alloc_aligned<float>(pData, capacity * 2, 64);
+                if (ptr == NULL)
+                    return false;
+
+                nCapacity           = capacity;
+                vData               = ptr;
+            }
+
+            clear();
+            return true;
+        }
+
+        void MirrorBuffer::clear()
+        {
+            if (vData == NULL)
+                return;
+
+            dsp::fill_zero(vData, (nMapSize > 0) ? nCapacity : nCapacity * 2);
+            nHead           = 0;
+        }
+
+        void MirrorBuffer::append(const float *src, size_t count)
+        {
+            if (vData == NULL)
+                return;
+
+            // Only the last samples remain in the buffer if the count exceeds the capacity
+            if (count > nCapacity)
+            {
+                src            += count - nCapacity;
+                count           = nCapacity;
+            }
+
+            // The range is always contiguous since the head is located in the first half
+            dsp::copy(&vData[nHead], src, count);
+            if (nMapSize <= 0)
+            {
+                // Duplicate the data to the other half of the buffer
+                const size_t head   = nCapacity - nHead;
+                if (count <= head)
+                    dsp::copy(&vData[nHead + nCapacity], src, count);
+                else
+                {
+                    dsp::copy(&vData[nHead + nCapacity], src, head);
+                    dsp::copy(vData, &src[head], count - head);
+                }
+            }
+
+            nHead           = (nHead + count) % nCapacity;
+        }
+
+        void MirrorBuffer::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nCapacity", nCapacity);
+            v->write("nHead", nHead);
+            v->write("nDelay", nDelay);
+            v->write("nMapSize", nMapSize);
+            v->write("vData", vData);
+            v->write("pData", pData);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
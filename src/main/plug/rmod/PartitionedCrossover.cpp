@@ -0,0 +1,529 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/rmod/PartitionedCrossover.h>
+#include <private/rmod/xover.h>
+
+#include <math.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        PartitionedCrossover::PartitionedCrossover()
+        {
+            construct();
+        }
+
+        PartitionedCrossover::~PartitionedCrossover()
+        {
+            destroy();
+        }
+
+        void PartitionedCrossover::construct()
+        {
+            nRank           = 0;
+            nMaxRank        = 0;
+            nPartRank       = 0;
+            nBands          = 0;
+            nSampleRate     = 0;
+            nOffset         = 0;
+            nHead           = 0;
+            bUpdate         = true;
+            vBands          = NULL;
+            vInBuf[0]       = NULL;
+            vInBuf[1]       = NULL;
+            vFdl            = NULL;
+            vAcc            = NULL;
+            vTmp            = NULL;
+            vFir            = NULL;
+            vImpulse        = NULL;
+            pData           = NULL;
+        }
+
+        void PartitionedCrossover::destroy()
+        {
+            free_aligned(pData);
+            construct();
+        }
+
+        bool PartitionedCrossover::init(size_t rank, size_t part_rank, size_t bands)
+        {
+            const size_t sample_rate    = nSampleRate;
+            destroy();
+
+            if (rank < 1)
+                return false;
+
+            // The size of the frequency-domain delay line and kernels does not depend on the
+            // partition size, other buffers are allocated for the largest partition, so the
+            // partition size can be changed later without reallocation
+            const size_t length         = size_t(1) << rank;        // Length of the filter
+            const size_t part           = length >> 1;              // The largest size of the partition
+            const size_t szof_length    = align_size(sizeof(float) * length, 64);
+            const size_t szof_part      = align_size(sizeof(float) * part, 64);
+            const size_t szof_spectrum  = szof_part * 4;            // Packed complex spectrum of 2 partitions
+            const size_t szof_fdl       = szof_length * 4;          // Packed complex spectra of all partitions
+            const size_t szof_bands     = align_size(sizeof(band_t) * bands, 64);
+            const size_t to_alloc       =
+                szof_bands +
+                szof_part * 2 * 2 + // vInBuf
+                szof_fdl + // vFdl
+                szof_spectrum + // vAcc
+                szof_spectrum + // vTmp
+                szof_length * 2 + // vFir
+                szof_length + // vImpulse
+                bands * (
+                    szof_fdl + // vKernel
+                    szof_part * 2 // vOut
+                );
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, 64);
+            if (ptr == NULL)
+                return false;
+
+            nRank                       = rank;
+            nMaxRank                    = rank;
+            nPartRank                   = lsp_min(part_rank, rank - 1);
+            nBands                      = bands;
+            nSampleRate                 = sample_rate;
+            vBands                      = advance_ptr_bytes<band_t>(ptr, szof_bands);
+            vInBuf[0]                   = advance_ptr_bytes<float>(ptr, szof_part * 2);
+            vInBuf[1]                   = advance_ptr_bytes<float>(ptr, szof_part * 2);
+            vFdl                        = advance_ptr_bytes<float>(ptr, szof_fdl);
+            vAcc                        = advance_ptr_bytes<float>(ptr, szof_spectrum);
+            vTmp                        = advance_ptr_bytes<float>(ptr, szof_spectrum);
+            vFir                        = advance_ptr_bytes<float>(ptr, szof_length * 2);
+            vImpulse                    = advance_ptr_bytes<float>(ptr, szof_length);
+
+            for (size_t i=0; i<bands; ++i)
+            {
+                band_t *b                   = &vBands[i];
+
+                b->fHpfFreq                 = 0.0f;
+                b->fHpfSlope                = 0.0f;
+                b->fLpfFreq                 = 0.0f;
+                b->fLpfSlope                = 0.0f;
+                b->bHpf                     = false;
+                b->bLpf                     = false;
+                b->bEnabled                 = false;
+                b->bMuted                   = false;
+                b->bClear                   = true;
+                b->bUpdate                  = true;
+
+                b->vKernel                  = advance_ptr_bytes<float>(ptr, szof_fdl);
+                b->vOut[0]                  = advance_ptr_bytes<float>(ptr, szof_part);
+                b->vOut[1]                  = advance_ptr_bytes<float>(ptr, szof_part);
+
+                for (size_t j=0; j<2; ++j)
+                {
+                    handler_t *h                = &b->vHandlers[j];
+                    h->pFunc                    = NULL;
+                    h->pObject                  = NULL;
+                    h->pSubject                 = NULL;
+                }
+
+                dsp::fill_zero(b->vKernel, length * 4);
+            }
+
+            clear();
+            bUpdate                     = true;
+
+            return true;
+        }
+
+        void PartitionedCrossover::set_sample_rate(size_t sr)
+        {
+            if (nSampleRate == sr)
+                return;
+            nSampleRate     = sr;
+            bUpdate         = true;
+
+            // The frequency grid has changed, all bands need to be updated
+            for (size_t i=0; i<nBands; ++i)
+                vBands[i].bUpdate   = true;
+        }
+
+        void PartitionedCrossover::set_partition(size_t part_rank)
+        {
+            set_rank(nRank, part_rank);
+        }
+
+        void PartitionedCrossover::set_rank(size_t rank, size_t part_rank)
+        {
+            rank            = lsp_min(rank, nMaxRank);
+            if (rank < 1)
+                return;
+
+            part_rank       = lsp_min(part_rank, rank - 1);
+            if ((nRank == rank) && (nPartRank == part_rank))
+                return;
+            nRank           = rank;
+            nPartRank       = part_rank;
+            bUpdate         = true;
+
+            // The kernels are built for the new filter length and partition size,
+            // the processing starts from the clean state
+            for (size_t i=0; i<nBands; ++i)
+                vBands[i].bUpdate   = true;
+            clear();
+        }
+
+        void PartitionedCrossover::enable_band(size_t band, bool enable)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if (b->bEnabled == enable)
+                return;
+
+            b->bEnabled     = enable;
+            b->bClear       = true;
+            b->bUpdate      = true;
+            bUpdate         = true;
+        }
+
+        void PartitionedCrossover::mute_band(size_t band, bool mute)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if (b->bMuted == mute)
+                return;
+
+            b->bMuted       = mute;
+            if ((mute) || (pData == NULL))
+                return;
+
+            // The output of the band is outdated, start from the clean state
+            const size_t part   = size_t(1) << nPartRank;
+            dsp::fill_zero(b->vOut[0], part);
+            dsp::fill_zero(b->vOut[1], part);
+        }
+
+        void PartitionedCrossover::set_hpf(size_t band, float freq, float slope, bool enabled)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if ((b->fHpfFreq == freq) && (b->fHpfSlope == slope) && (b->bHpf == enabled))
+                return;
+
+            b->fHpfFreq     = freq;
+            b->fHpfSlope    = slope;
+            b->bHpf         = enabled;
+            b->bUpdate      = true;
+            bUpdate         = true;
+        }
+
+        void PartitionedCrossover::set_lpf(size_t band, float freq, float slope, bool enabled)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if ((b->fLpfFreq == freq) && (b->fLpfSlope == slope) && (b->bLpf == enabled))
+                return;
+
+            b->fLpfFreq     = freq;
+            b->fLpfSlope    = slope;
+            b->bLpf         = enabled;
+            b->bUpdate      = true;
+            bUpdate         = true;
+        }
+
+        void PartitionedCrossover::set_handler(size_t channel, size_t band, dspu::crossover_func_t func, void *object, void *subject)
+        {
+            if ((band >= nBands) || (channel >= 2))
+                return;
+
+            handler_t *h    = &vBands[band].vHandlers[channel];
+            h->pFunc        = func;
+            h->pObject      = object;
+            h->pSubject     = subject;
+        }
+
+        void PartitionedCrossover::update_kernels()
+        {
+            const size_t length = size_t(1) << nRank;
+            const size_t half   = length >> 1;
+            const size_t part   = size_t(1) << nPartRank;
+            const size_t parts  = length / part;
+            const float kf      = float(nSampleRate) / float(length);
+
+            for (size_t i=0; i<nBands; ++i)
+            {
+                band_t *b           = &vBands[i];
+                if (b->bClear)
+                {
+                    dsp::fill_zero(b->vOut[0], part);
+                    dsp::fill_zero(b->vOut[1], part);
+                    b->bClear           = false;
+                }
+                if ((!b->bEnabled) || (!b->bUpdate))
+                    continue;
+                b->bUpdate          = false;
+
+                // Compute the band magnitude at the frequencies of the FFT bins,
+                // the impulse buffer is not used yet and holds the magnitude
+                for (size_t k=0; k<=half; ++k)
+                    vFir[k]             = k * kf;
+                xover::band_gain(vImpulse, vFir,
+                    b->fHpfFreq, b->fHpfSlope, b->bHpf,
+                    b->fLpfFreq, b->fLpfSlope, b->bLpf,
+                    half + 1);
+
+                // Build the zero-phase impulse response from the real and symmetric band mask
+                dsp::fill_zero(vFir, length * 2);
+                for (size_t k=0; k<=half; ++k)
+                {
+                    const float g       = vImpulse[k];
+                    vFir[k*2]           = g;
+                    if ((k > 0) && (k < half))
+                        vFir[(length - k)*2]    = g;
+                }
+                dsp::packed_reverse_fft(vFir, vFir, nRank);
+
+                // Make the filter causal by shifting it by a half of the length,
+                // apply the window to reduce the effect of truncation
+                for (size_t j=0; j<length; ++j)
+                {
+                    const float w       = 0.5f - 0.5f * cosf((2.0f * M_PI * j) / length);
+                    vImpulse[j]         = vFir[((j + half) & (length - 1)) * 2] * w;
+                }
+
+                // Compute the spectrum of each zero-padded partition of the filter
+                for (size_t j=0; j<parts; ++j)
+                {
+                    float *kernel       = &b->vKernel[j * part * 4];
+                    dsp::fill_zero(kernel, part * 4);
+                    for (size_t k=0; k<part; ++k)
+                        kernel[k*2]         = vImpulse[j * part + k];
+                    dsp::packed_direct_fft(kernel, kernel, nPartRank + 1);
+                }
+            }
+        }
+
+        void PartitionedCrossover::update_settings()
+        {
+            if (!bUpdate)
+                return;
+            bUpdate         = false;
+
+            if ((pData == NULL) || (nSampleRate <= 0))
+                return;
+
+            update_kernels();
+        }
+
+        void PartitionedCrossover::clear()
+        {
+            if (pData == NULL)
+                return;
+
+            const size_t length = size_t(1) << nRank;
+            const size_t part   = size_t(1) << nPartRank;
+            const size_t parts  = length / part;
+
+            dsp::fill_zero(vInBuf[0], part * 2);
+            dsp::fill_zero(vInBuf[1], part * 2);
+            dsp::fill_zero(vFdl, part * 4 * parts);
+            for (size_t i=0; i<nBands; ++i)
+            {
+                band_t *b           = &vBands[i];
+                dsp::fill_zero(b->vOut[0], part);
+                dsp::fill_zero(b->vOut[1], part);
+                b->bClear           = false;
+            }
+
+            nOffset         = 0;
+            nHead           = 0;
+        }
+
+        void PartitionedCrossover::freq_chart(size_t band, float *tr, const float *f, size_t count) const
+        {
+            if (band >= nBands)
+                return;
+
+            const band_t *b     = &vBands[band];
+            if (!b->bEnabled)
+            {
+                dsp::fill_zero(tr, count);
+                return;
+            }
+
+            xover::band_gain(tr, f,
+                b->fHpfFreq, b->fHpfSlope, b->bHpf,
+                b->fLpfFreq, b->fLpfSlope, b->bLpf,
+                count);
+        }
+
+        void PartitionedCrossover::process_partition()
+        {
+            const size_t part   = size_t(1) << nPartRank;
+            const size_t parts  = size_t(1) << (nRank - nPartRank);
+            const size_t step   = part * 4;
+            const float *l      = vInBuf[0];
+            const float *r      = vInBuf[1];
+
+            // Pack two last blocks of left and right channels as real and imaginary parts
+            // of the complex signal and store the spectrum to the frequency-domain delay line
+            float *fdl          = &vFdl[nHead * step];
+            for (size_t i=0; i<part*2; ++i)
+            {
+                fdl[i*2]            = l[i];
+                fdl[i*2 + 1]        = r[i];
+            }
+            dsp::packed_direct_fft(fdl, fdl, nPartRank + 1);
+
+            // Shift the input buffers
+            dsp::copy(vInBuf[0], &vInBuf[0][part], part);
+            dsp::copy(vInBuf[1], &vInBuf[1][part], part);
+
+            for (size_t i=0; i<nBands; ++i)
+            {
+                band_t *b           = &vBands[i];
+                if ((!b->bEnabled) || (b->bMuted))
+                    continue;
+
+                // Multiply each partition of the filter by the spectrum of the corresponding block
+                const float *kernel = b->vKernel;
+                dsp::pcomplex_mul3(vAcc, fdl, kernel, part * 2);
+                for (size_t j=1; j<parts; ++j)
+                {
+                    const size_t idx    = (nHead + parts - j) & (parts - 1);
+                    dsp::pcomplex_mul3(vTmp, &vFdl[idx * step], &kernel[j * step], part * 2);
+                    dsp::add2(vAcc, vTmp, step);
+                }
+                dsp::packed_reverse_fft(vAcc, vAcc, nPartRank + 1);
+
+                // The second half of the result is the valid part of the circular convolution,
+                // the real part is the left channel and the imaginary part is the right channel
+                const float *src    = &vAcc[part * 2];
+                float *bl           = b->vOut[0];
+                float *br           = b->vOut[1];
+                for (size_t j=0; j<part; ++j)
+                {
+                    bl[j]               = src[j*2];
+                    br[j]               = src[j*2 + 1];
+                }
+            }
+
+            nHead               = (nHead + 1) & (parts - 1);
+        }
+
+        void PartitionedCrossover::process(const float *left, const float *right, size_t samples)
+        {
+            if (pData == NULL)
+                return;
+            if (bUpdate)
+                update_settings();
+
+            const size_t channels   = (right != NULL) ? 2 : 1;
+            const size_t part       = size_t(1) << nPartRank;
+
+            for (size_t offset=0; offset < samples; )
+            {
+                const size_t to_do      = lsp_min(samples - offset, part - nOffset);
+
+                // Append data to the input buffers
+                dsp::copy(&vInBuf[0][part + nOffset], &left[offset], to_do);
+                if (right != NULL)
+                    dsp::copy(&vInBuf[1][part + nOffset], &right[offset], to_do);
+                else
+                    dsp::fill_zero(&vInBuf[1][part + nOffset], to_do);
+
+                // Pass the processed data to the handlers
+                for (size_t i=0; i<nBands; ++i)
+                {
+                    const band_t *b         = &vBands[i];
+                    if ((!b->bEnabled) || (b->bMuted))
+                        continue;
+
+                    for (size_t j=0; j<channels; ++j)
+                    {
+                        const handler_t *h      = &b->vHandlers[j];
+                        if (h->pFunc != NULL)
+                            h->pFunc(h->pObject, h->pSubject, i, &b->vOut[j][nOffset], offset, to_do);
+                    }
+                }
+
+                nOffset                += to_do;
+                offset                 += to_do;
+
+                // Process the partition if the block is complete
+                if (nOffset >= part)
+                {
+                    process_partition();
+                    nOffset                 = 0;
+                }
+            }
+        }
+
+        void PartitionedCrossover::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nRank", nRank);
+            v->write("nMaxRank", nMaxRank);
+            v->write("nPartRank", nPartRank);
+            v->write("nBands", nBands);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nOffset", nOffset);
+            v->write("nHead", nHead);
+            v->write("bUpdate", bUpdate);
+            v->begin_array("vBands", vBands, nBands);
+            for (size_t i=0; i<nBands; ++i)
+            {
+                const band_t *b = &vBands[i];
+                v->begin_object(b, sizeof(band_t));
+                {
+                    v->write("fHpfFreq", b->fHpfFreq);
+                    v->write("fHpfSlope", b->fHpfSlope);
+                    v->write("fLpfFreq", b->fLpfFreq);
+                    v->write("fLpfSlope", b->fLpfSlope);
+                    v->write("bHpf", b->bHpf);
+                    v->write("bLpf", b->bLpf);
+                    v->write("bEnabled", b->bEnabled);
+                    v->write("bMuted", b->bMuted);
+                    v->write("bClear", b->bClear);
+                    v->write("bUpdate", b->bUpdate);
+                    v->write("vKernel", b->vKernel);
+                    v->writev("vOut", b->vOut, 2);
+                }
+                v->end_object();
+            }
+            v->end_array();
+            v->writev("vInBuf", vInBuf, 2);
+            v->write("vFdl", vFdl);
+            v->write("vAcc", vAcc);
+            v->write("vTmp", vTmp);
+            v->write("vFir", vFir);
+            v->write("vImpulse", vImpulse);
+            v->write("pData", pData);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <private/rmod/Semaphore.h>
+
+#if defined(PLATFORM_LINUX)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif /* PLATFORM_LINUX */
+
+#ifdef ARCH_X86
+    #include <immintrin.h>
+#endif /* ARCH_X86 */
+
+namespace lsp
+{
+    namespace rmod
+    {
+        static inline void cpu_relax()
+        {
+        #if defined(ARCH_X86)
+            _mm_pause();
+        #elif defined(__aarch64__) || defined(__ARM_ARCH_7A__)
+            __asm__ __volatile__ ("yield");
+        #endif
+        }
+
+        Semaphore::Semaphore()
+        {
+            nCount          = 0;
+            nWaiters        = 0;
+        #if defined(PLATFORM_WINDOWS)
+            hSemaphore      = CreateSemaphoreW(NULL, 0, 0x7fffffff, NULL);
+        #elif !defined(PLATFORM_LINUX)
+            pthread_mutex_init(&sMutex, NULL);
+            pthread_cond_init(&sCond, NULL);
+        #endif /* PLATFORM_WINDOWS */
+        }
+
+        Semaphore::~Semaphore()
+        {
+        #if defined(PLATFORM_WINDOWS)
+            if (hSemaphore != NULL)
+            {
+                CloseHandle(hSemaphore);
+                hSemaphore      = NULL;
+            }
+        #elif !defined(PLATFORM_LINUX)
+            pthread_cond_destroy(&sCond);
+            pthread_mutex_destroy(&sMutex);
+        #endif /* PLATFORM_WINDOWS */
+        }
+
+        void Semaphore::sleep()
+        {
+        #if defined(PLATFORM_LINUX)
+            // The kernel puts the thread to sleep only if the counter is still zero
+            syscall(SYS_futex, &nCount, FUTEX_WAIT_PRIVATE, 0, NULL, NULL, 0);
+        #elif defined(PLATFORM_WINDOWS)
+            // The posted signal is never lost since the native semaphore counts it
+            WaitForSingleObject(hSemaphore, INFINITE);
+        #else
+            // The counter is checked under the lock, so the poster can not signal
+            // between the check and the wait
+            pthread_mutex_lock(&sMutex);
+            while (atomic_load(&nCount) <= 0)
+                pthread_cond_wait(&sCond, &sMutex);
+            pthread_mutex_unlock(&sMutex);
+        #endif /* PLATFORM_LINUX */
+        }
+
+        void Semaphore::wake()
+        {
+        #if defined(PLATFORM_LINUX)
+            syscall(SYS_futex, &nCount, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        #elif defined(PLATFORM_WINDOWS)
+            ReleaseSemaphore(hSemaphore, 1, NULL);
+        #else
+            pthread_mutex_lock(&sMutex);
+            pthread_cond_signal(&sCond);
+            pthread_mutex_unlock(&sMutex);
+        #endif /* PLATFORM_LINUX */
+        }
+
+        bool Semaphore::try_acquire()
+        {
+            while (true)
+            {
+                const atomic_t count    = atomic_load(&nCount);
+                if (count <= 0)
+                    return false;
+                if (atomic_cas(&nCount, count, count - 1))
+                    return true;
+            }
+        }
+
+        void Semaphore::post()
+        {
+            atomic_add(&nCount, 1);
+            if (atomic_load(&nWaiters) > 0)
+                wake();
+        }
+
+        void Semaphore::wait(size_t spin)
+        {
+            // Spin for a while, the other side usually completes its job in a few microseconds
+            for (size_t i=0; i<spin; ++i)
+            {
+                if (try_acquire())
+                    return;
+                cpu_relax();
+            }
+
+            // Go to sleep. The waiter is registered before the last check of the counter,
+            // so the poster either sees the waiter or the waiter sees the new counter value
+            while (!try_acquire())
+            {
+                atomic_add(&nWaiters, 1);
+                if (atomic_load(&nCount) <= 0)
+                    sleep();
+                atomic_add(&nWaiters, -1);
+            }
+        }
+
+        void Semaphore::reset()
+        {
+            while (try_acquire())
+                /* nothing */;
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/rmod/SlidingMax.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        SlidingMax::SlidingMax()
+        {
+            construct();
+        }
+
+        SlidingMax::~SlidingMax()
+        {
+            destroy();
+        }
+
+        void SlidingMax::construct()
+        {
+            nCapacity       = 0;
+            nWindow         = 0;
+            nPos            = 0;
+            fPrefix         = 0.0f;
+            vSuffix         = NULL;
+            vBlock          = NULL;
+            pData           = NULL;
+        }
+
+        void SlidingMax::destroy()
+        {
+            free_aligned(pData);
+            construct();
+        }
+
+        bool SlidingMax::init(size_t capacity)
+        {
+            const size_t window         = nWindow;
+            destroy();
+
+            const size_t szof_suffix    = align_size(sizeof(float) * (capacity + 1), 64);
+            const size_t szof_block     = align_size(sizeof(float) * capacity, 64);
+            const size_t to_alloc       = szof_suffix + szof_block;
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, 64);
+            if (ptr == NULL)
+                return false;
+
+            nCapacity                   = capacity;
+            vSuffix                     = advance_ptr_bytes<float>(ptr, szof_suffix);
+            vBlock                      = advance_ptr_bytes<float>(ptr, szof_block);
+            nWindow                     = lsp_min(window, capacity);
+
+            clear();
+
+            return true;
+        }
+
+        void SlidingMax::set_window(size_t window)
+        {
+            window          = lsp_min(window, nCapacity);
+            if (nWindow == window)
+                return;
+
+            nWindow         = window;
+            clear();
+        }
+
+        void SlidingMax::clear()
+        {
+            if (pData == NULL)
+                return;
+
+            nPos            = 0;
+            fPrefix         = 0.0f;
+            dsp::fill_zero(vSuffix, nWindow + 1);
+        }
+
+        void SlidingMax::complete_block()
+        {
+            // Compute suffix maximums of the block, the element past the end
+            // of the block is zero and covers the window ending at the block end
+            float max       = 0.0f;
+            for (size_t i=nWindow; i > 0; )
+            {
+                --i;
+                max             = lsp_max(max, vBlock[i]);
+                vSuffix[i]      = max;
+            }
+
+            nPos            = 0;
+            fPrefix         = 0.0f;
+        }
+
+        void SlidingMax::process(float *dst, const float *src, size_t count)
+        {
+            if (nWindow <= 1)
+            {
+                if (dst != src)
+                    dsp::copy(dst, src, count);
+                return;
+            }
+
+            for (size_t offset=0; offset < count; )
+            {
+                const size_t to_do  = lsp_min(count - offset, nWindow - nPos);
+                const float *blk    = &vBlock[nPos];
+                float *out          = &dst[offset];
+
+                // Store samples of the block and compute the running prefix maximum
+                dsp::copy(&vBlock[nPos], &src[offset], to_do);
+                float max           = fPrefix;
+                for (size_t i=0; i<to_do; ++i)
+                {
+                    max                 = lsp_max(max, blk[i]);
+                    out[i]              = max;
+                }
+                fPrefix             = max;
+
+                // Combine with the suffix maximum of the previous block
+                dsp::pmax2(out, &vSuffix[nPos + 1], to_do);
+
+                nPos               += to_do;
+                offset             += to_do;
+                if (nPos >= nWindow)
+                    complete_block();
+            }
+        }
+
+        void SlidingMax::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nCapacity", nCapacity);
+            v->write("nWindow", nWindow);
+            v->write("nPos", nPos);
+            v->write("fPrefix", fPrefix);
+            v->write("vSuffix", vSuffix);
+            v->write("vBlock", vBlock);
+            v->write("pData", pData);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+
+#include <private/rmod/SpectrumTap.h>
+
+#include <math.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        SpectrumTap::SpectrumTap()
+        {
+            construct();
+        }
+
+        SpectrumTap::~SpectrumTap()
+        {
+            destroy();
+        }
+
+        void SpectrumTap::construct()
+        {
+            nPoints         = 0;
+            nSampleRate     = 0;
+            nRank           = 0;
+            fReactivity     = 0.0f;
+            fShift          = 1.0f;
+            fTau            = 1.0f;
+            fNorm           = 0.0f;
+            bActive         = false;
+            bUpdate         = true;
+
+            vFreqs          = NULL;
+            vIndexes        = NULL;
+            vSpectrum[0]    = NULL;
+            vSpectrum[1]    = NULL;
+            pData           = NULL;
+        }
+
+        void SpectrumTap::destroy()
+        {
+            free_aligned(pData);
+            construct();
+        }
+
+        bool SpectrumTap::init(const float *freqs, size_t points)
+        {
+            destroy();
+            if (points <= 0)
+                return false;
+
+            const size_t szof_points    = align_size(sizeof(float) * points, 64);
+            const size_t szof_indexes   = align_size(sizeof(uint32_t) * points, 64);
+            const size_t to_alloc       = szof_points * 3 + szof_indexes;
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, 64);
+            if (ptr == NULL)
+                return false;
+
+            nPoints                     = points;
+            vFreqs                      = advance_ptr_bytes<float>(ptr, szof_points);
+            vIndexes                    = advance_ptr_bytes<uint32_t>(ptr, szof_indexes);
+            vSpectrum[0]                = advance_ptr_bytes<float>(ptr, szof_points);
+            vSpectrum[1]                = advance_ptr_bytes<float>(ptr, szof_points);
+
+            dsp::copy(vFreqs, freqs, points);
+            for (size_t i=0; i<points; ++i)
+                vIndexes[i]                 = 0;
+            clear();
+
+            return true;
+        }
+
+        void SpectrumTap::set_sample_rate(size_t sr)
+        {
+            if (nSampleRate == sr)
+                return;
+            nSampleRate     = sr;
+            bUpdate         = true;
+        }
+
+        void SpectrumTap::set_reactivity(float reactivity)
+        {
+            if (fReactivity == reactivity)
+                return;
+            fReactivity     = reactivity;
+            bUpdate         = true;
+        }
+
+        void SpectrumTap::set_shift(float shift)
+        {
+            if (fShift == shift)
+                return;
+            fShift          = shift;
+            bUpdate         = true;
+        }
+
+        void SpectrumTap::set_active(bool active)
+        {
+            if (bActive == active)
+                return;
+
+            // The spectrum is outdated when the computation is resumed
+            bActive         = active;
+            if (active)
+                clear();
+        }
+
+        void SpectrumTap::clear()
+        {
+            if (pData == NULL)
+                return;
+
+            dsp::fill_zero(vSpectrum[0], nPoints);
+            dsp::fill_zero(vSpectrum[1], nPoints);
+        }
+
+        void SpectrumTap::update_settings(size_t rank)
+        {
+            bUpdate         = false;
+            nRank           = rank;
+
+            const size_t frame  = size_t(1) << rank;
+            const size_t hop    = frame >> 1;
+            const float scale   = (nSampleRate > 0) ? float(frame) / float(nSampleRate) : 0.0f;
+
+            // Each channel is a half of the sum of two packed spectrum components
+            fNorm           = fShift * 0.5f / float(frame);
+
+            // The spectrum is updated once per frame hop
+            const float frames  = dspu::millis_to_samples(nSampleRate, fReactivity) / float(hop);
+            fTau            = (frames > 0.0f) ? 1.0f - expf(logf(1.0f - M_SQRT1_2) / frames) : 1.0f;
+
+            for (size_t i=0; i<nPoints; ++i)
+            {
+                const size_t ix     = scale * vFreqs[i];
+                vIndexes[i]         = lsp_min(ix, hop);
+            }
+        }
+
+        void SpectrumTap::process(const float *fft, size_t rank)
+        {
+            if ((!bActive) || (pData == NULL))
+                return;
+            if ((bUpdate) || (rank != nRank))
+                update_settings(rank);
+
+            const size_t mask   = (size_t(1) << rank) - 1;
+            float * const l     = vSpectrum[0];
+            float * const r     = vSpectrum[1];
+
+            for (size_t i=0; i<nPoints; ++i)
+            {
+                const size_t k      = vIndexes[i];
+                const float *a      = &fft[k * 2];
+                const float *b      = &fft[((-k) & mask) * 2];
+
+                // Unpack spectra of left and right channels
+                const float lre     = a[0] + b[0];
+                const float lim     = a[1] - b[1];
+                const float rre     = a[1] + b[1];
+                const float rim     = a[0] - b[0];
+
+                const float ml      = sqrtf(lre * lre + lim * lim) * fNorm;
+                const float mr      = sqrtf(rre * rre + rim * rim) * fNorm;
+
+                l[i]               += (ml - l[i]) * fTau;
+                r[i]               += (mr - r[i]) * fTau;
+            }
+        }
+
+        void SpectrumTap::get_spectrum(size_t channel, float *dst) const
+        {
+            if ((channel >= 2) || (pData == NULL))
+                return;
+            dsp::copy(dst, vSpectrum[channel], nPoints);
+        }
+
+        void SpectrumTap::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nPoints", nPoints);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nRank", nRank);
+            v->write("fReactivity", fReactivity);
+            v->write("fShift", fShift);
+            v->write("fTau", fTau);
+            v->write("fNorm", fNorm);
+            v->write("bActive", bActive);
+            v->write("bUpdate", bUpdate);
+            v->write("vFreqs", vFreqs);
+            v->write("vIndexes", vIndexes);
+            v->writev("vSpectrum", vSpectrum, 2);
+            v->write("pData", pData);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
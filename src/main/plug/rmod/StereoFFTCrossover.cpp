@@ -0,0 +1,519 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#include <private/rmod/StereoFFTCrossover.h>
+#include <private/rmod/xover.h>
+
+#include <math.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        StereoFFTCrossover::StereoFFTCrossover()
+        {
+            construct();
+        }
+
+        StereoFFTCrossover::~StereoFFTCrossover()
+        {
+            destroy();
+        }
+
+        void StereoFFTCrossover::construct()
+        {
+            nRank           = 0;
+            nMaxRank        = 0;
+            nBands          = 0;
+            nSampleRate     = 0;
+            nOffset         = 0;
+            fPhase          = 0.0f;
+            bUpdate         = true;
+            vBands          = NULL;
+            pSpecFunc       = NULL;
+            pSpecObject     = NULL;
+            pSpecSubject    = NULL;
+            vWindow         = NULL;
+            vInBuf[0]       = NULL;
+            vInBuf[1]       = NULL;
+            vFft            = NULL;
+            vTmp            = NULL;
+            pData           = NULL;
+        }
+
+        void StereoFFTCrossover::destroy()
+        {
+            free_aligned(pData);
+            construct();
+        }
+
+        bool StereoFFTCrossover::init(size_t rank, size_t bands)
+        {
+            const size_t sample_rate    = nSampleRate;
+            const float phase           = fPhase;
+            destroy();
+
+            const size_t frame          = size_t(1) << rank;
+            const size_t hop            = frame >> 1;
+            const size_t szof_frame     = align_size(sizeof(float) * frame, 64);
+            const size_t szof_cframe    = szof_frame * 2;
+            const size_t szof_hop       = align_size(sizeof(float) * hop, 64);
+            const size_t szof_bands     = align_size(sizeof(band_t) * bands, 64);
+            const size_t to_alloc       =
+                szof_bands +
+                szof_frame + // vWindow
+                szof_frame * 2 + // vInBuf
+                szof_cframe + // vFft
+                szof_cframe + // vTmp
+                bands * (
+                    szof_cframe + // vMask
+                    szof_cframe + // vAcc
+                    szof_hop * 2 // vOut
+                );
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, 64);
+            if (ptr == NULL)
+                return false;
+
+            nRank                       = rank;
+            nMaxRank                    = rank;
+            nBands                      = bands;
+            nSampleRate                 = sample_rate;
+            vBands                      = advance_ptr_bytes<band_t>(ptr, szof_bands);
+            vWindow                     = advance_ptr_bytes<float>(ptr, szof_frame);
+            vInBuf[0]                   = advance_ptr_bytes<float>(ptr, szof_frame);
+            vInBuf[1]                   = advance_ptr_bytes<float>(ptr, szof_frame);
+            vFft                        = advance_ptr_bytes<float>(ptr, szof_cframe);
+            vTmp                        = advance_ptr_bytes<float>(ptr, szof_cframe);
+
+            for (size_t i=0; i<bands; ++i)
+            {
+                band_t *b                   = &vBands[i];
+
+                b->fHpfFreq                 = 0.0f;
+                b->fHpfSlope                = 0.0f;
+                b->fLpfFreq                 = 0.0f;
+                b->fLpfSlope                = 0.0f;
+                b->bHpf                     = false;
+                b->bLpf                     = false;
+                b->bEnabled                 = false;
+                b->bMuted                   = false;
+                b->bClear                   = true;
+                b->bUpdate                  = true;
+
+                b->vMask                    = advance_ptr_bytes<float>(ptr, szof_cframe);
+                b->vAcc                     = advance_ptr_bytes<float>(ptr, szof_cframe);
+                b->vOut[0]                  = advance_ptr_bytes<float>(ptr, szof_hop);
+                b->vOut[1]                  = advance_ptr_bytes<float>(ptr, szof_hop);
+
+                for (size_t j=0; j<2; ++j)
+                {
+                    handler_t *h                = &b->vHandlers[j];
+                    h->pFunc                    = NULL;
+                    h->pObject                  = NULL;
+                    h->pSubject                 = NULL;
+                }
+
+                dsp::fill_zero(b->vMask, frame * 2);
+            }
+
+            update_window();
+            set_phase(phase);
+            clear();
+            bUpdate                     = true;
+
+            return true;
+        }
+
+        void StereoFFTCrossover::update_window()
+        {
+            // Periodic Hann window: the sum of two windows shifted by half of the frame is unity
+            const size_t frame  = size_t(1) << nRank;
+            for (size_t i=0; i<frame; ++i)
+                vWindow[i]          = 0.5f - 0.5f * cosf((2.0f * M_PI * i) / frame);
+        }
+
+        void StereoFFTCrossover::set_rank(size_t rank)
+        {
+            rank            = lsp_min(rank, nMaxRank);
+            if ((rank == nRank) || (rank < 1))
+                return;
+
+            nRank           = rank;
+            bUpdate         = true;
+
+            // Masks are defined on the new frequency grid, all bands need to be updated
+            for (size_t i=0; i<nBands; ++i)
+                vBands[i].bUpdate   = true;
+
+            update_window();
+            clear();
+        }
+
+        void StereoFFTCrossover::set_sample_rate(size_t sr)
+        {
+            if (nSampleRate == sr)
+                return;
+            nSampleRate     = sr;
+            bUpdate         = true;
+
+            // The frequency grid has changed, all bands need to be updated
+            for (size_t i=0; i<nBands; ++i)
+                vBands[i].bUpdate   = true;
+        }
+
+        void StereoFFTCrossover::set_phase(float phase)
+        {
+            fPhase          = lsp_limit(phase, 0.0f, 1.0f);
+            if (nRank <= 0)
+                return;
+
+            const size_t hop    = size_t(1) << (nRank - 1);
+            nOffset             = size_t(fPhase * hop) % hop;
+        }
+
+        void StereoFFTCrossover::enable_band(size_t band, bool enable)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if (b->bEnabled == enable)
+                return;
+
+            b->bEnabled     = enable;
+            b->bClear       = true;
+            b->bUpdate      = true;
+            bUpdate         = true;
+        }
+
+        void StereoFFTCrossover::mute_band(size_t band, bool mute)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if (b->bMuted == mute)
+                return;
+
+            b->bMuted       = mute;
+            if ((mute) || (pData == NULL))
+                return;
+
+            // The state of the band is outdated, start from the clean state
+            const size_t frame  = size_t(1) << nRank;
+            dsp::fill_zero(b->vAcc, frame * 2);
+            dsp::fill_zero(b->vOut[0], frame >> 1);
+            dsp::fill_zero(b->vOut[1], frame >> 1);
+        }
+
+        void StereoFFTCrossover::set_hpf(size_t band, float freq, float slope, bool enabled)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if ((b->fHpfFreq == freq) && (b->fHpfSlope == slope) && (b->bHpf == enabled))
+                return;
+
+            b->fHpfFreq     = freq;
+            b->fHpfSlope    = slope;
+            b->bHpf         = enabled;
+            b->bUpdate      = true;
+            bUpdate         = true;
+        }
+
+        void StereoFFTCrossover::set_lpf(size_t band, float freq, float slope, bool enabled)
+        {
+            if (band >= nBands)
+                return;
+
+            band_t *b       = &vBands[band];
+            if ((b->fLpfFreq == freq) && (b->fLpfSlope == slope) && (b->bLpf == enabled))
+                return;
+
+            b->fLpfFreq     = freq;
+            b->fLpfSlope    = slope;
+            b->bLpf         = enabled;
+            b->bUpdate      = true;
+            bUpdate         = true;
+        }
+
+        void StereoFFTCrossover::set_handler(size_t channel, size_t band, dspu::crossover_func_t func, void *object, void *subject)
+        {
+            if ((band >= nBands) || (channel >= 2))
+                return;
+
+            handler_t *h    = &vBands[band].vHandlers[channel];
+            h->pFunc        = func;
+            h->pObject      = object;
+            h->pSubject     = subject;
+        }
+
+        void StereoFFTCrossover::set_spectrum_handler(spectrum_func_t func, void *object, void *subject)
+        {
+            pSpecFunc       = func;
+            pSpecObject     = object;
+            pSpecSubject    = subject;
+        }
+
+        void StereoFFTCrossover::update_masks()
+        {
+            const size_t frame  = size_t(1) << nRank;
+            const size_t half   = frame >> 1;
+            const float kf      = float(nSampleRate) / float(frame);
+
+            // Frequencies of the FFT bins and the band magnitude are stored in the temporary buffer
+            float *freq         = vTmp;
+            float *gain         = &vTmp[half + 1];
+            for (size_t k=0; k<=half; ++k)
+                freq[k]             = k * kf;
+
+            for (size_t i=0; i<nBands; ++i)
+            {
+                band_t *b           = &vBands[i];
+                if (b->bClear)
+                {
+                    dsp::fill_zero(b->vAcc, frame * 2);
+                    dsp::fill_zero(b->vOut[0], half);
+                    dsp::fill_zero(b->vOut[1], half);
+                    b->bClear           = false;
+                }
+                if ((!b->bEnabled) || (!b->bUpdate))
+                    continue;
+                b->bUpdate          = false;
+
+                // The mask is real and symmetric: m[k] = m[N-k]. It is stored as packed
+                // complex numbers with equal real and imaginary parts, so it can be applied
+                // to the packed spectrum with the simple element-wise multiplication
+                float *mask         = b->vMask;
+                xover::band_gain(gain, freq,
+                    b->fHpfFreq, b->fHpfSlope, b->bHpf,
+                    b->fLpfFreq, b->fLpfSlope, b->bLpf,
+                    half + 1);
+
+                for (size_t k=0; k<=half; ++k)
+                {
+                    const float g       = gain[k];
+                    mask[k*2]           = g;
+                    mask[k*2 + 1]       = g;
+                    if ((k > 0) && (k < half))
+                    {
+                        mask[(frame - k)*2]     = g;
+                        mask[(frame - k)*2 + 1] = g;
+                    }
+                }
+            }
+        }
+
+        void StereoFFTCrossover::update_settings()
+        {
+            if (!bUpdate)
+                return;
+            bUpdate         = false;
+
+            if ((pData == NULL) || (nSampleRate <= 0))
+                return;
+
+            update_masks();
+        }
+
+        void StereoFFTCrossover::clear()
+        {
+            if (pData == NULL)
+                return;
+
+            const size_t frame  = size_t(1) << nRank;
+            const size_t half   = frame >> 1;
+
+            dsp::fill_zero(vInBuf[0], frame);
+            dsp::fill_zero(vInBuf[1], frame);
+            for (size_t i=0; i<nBands; ++i)
+            {
+                band_t *b           = &vBands[i];
+                dsp::fill_zero(b->vAcc, frame * 2);
+                dsp::fill_zero(b->vOut[0], half);
+                dsp::fill_zero(b->vOut[1], half);
+                b->bClear           = false;
+            }
+
+            set_phase(fPhase);
+        }
+
+        void StereoFFTCrossover::freq_chart(size_t band, float *tr, const float *f, size_t count) const
+        {
+            if (band >= nBands)
+                return;
+
+            const band_t *b     = &vBands[band];
+            if (!b->bEnabled)
+            {
+                dsp::fill_zero(tr, count);
+                return;
+            }
+
+            xover::band_gain(tr, f,
+                b->fHpfFreq, b->fHpfSlope, b->bHpf,
+                b->fLpfFreq, b->fLpfSlope, b->bLpf,
+                count);
+        }
+
+        void StereoFFTCrossover::process_frame()
+        {
+            const size_t frame  = size_t(1) << nRank;
+            const size_t hop    = frame >> 1;
+            const float *l      = vInBuf[0];
+            const float *r      = vInBuf[1];
+
+            // Pack left and right channels as real and imaginary parts of the complex signal
+            for (size_t i=0; i<frame; ++i)
+            {
+                vFft[i*2]           = l[i] * vWindow[i];
+                vFft[i*2 + 1]       = r[i] * vWindow[i];
+            }
+            dsp::packed_direct_fft(vFft, vFft, nRank);
+            if (pSpecFunc != NULL)
+                pSpecFunc(pSpecObject, pSpecSubject, vFft, nRank);
+
+            // Shift the input buffers
+            dsp::move(vInBuf[0], &vInBuf[0][hop], hop);
+            dsp::move(vInBuf[1], &vInBuf[1][hop], hop);
+
+            for (size_t i=0; i<nBands; ++i)
+            {
+                band_t *b           = &vBands[i];
+                if ((!b->bEnabled) || (b->bMuted))
+                    continue;
+
+                // Apply the mask and perform the reverse transform: the real part of
+                // the result is the band of the left channel, imaginary - of the right channel
+                dsp::mul3(vTmp, vFft, b->vMask, frame * 2);
+                dsp::packed_reverse_fft(vTmp, vTmp, nRank);
+
+                // Perform overlap-add, the first hop of the accumulator becomes complete
+                float *acc          = b->vAcc;
+                dsp::move(acc, &acc[frame], frame);
+                dsp::fill_zero(&acc[frame], frame);
+                dsp::add2(acc, vTmp, frame * 2);
+
+                // Unpack the complete part of the accumulator
+                float *bl           = b->vOut[0];
+                float *br           = b->vOut[1];
+                for (size_t j=0; j<hop; ++j)
+                {
+                    bl[j]               = acc[j*2];
+                    br[j]               = acc[j*2 + 1];
+                }
+            }
+        }
+
+        void StereoFFTCrossover::process(const float *left, const float *right, size_t samples)
+        {
+            if (pData == NULL)
+                return;
+            if (bUpdate)
+                update_settings();
+
+            const size_t channels   = (right != NULL) ? 2 : 1;
+            const size_t hop        = size_t(1) << (nRank - 1);
+
+            for (size_t offset=0; offset < samples; )
+            {
+                const size_t to_do      = lsp_min(samples - offset, hop - nOffset);
+
+                // Append data to the input buffers
+                dsp::copy(&vInBuf[0][hop + nOffset], &left[offset], to_do);
+                if (right != NULL)
+                    dsp::copy(&vInBuf[1][hop + nOffset], &right[offset], to_do);
+                else
+                    dsp::fill_zero(&vInBuf[1][hop + nOffset], to_do);
+
+                // Pass the processed data to the handlers
+                for (size_t i=0; i<nBands; ++i)
+                {
+                    const band_t *b         = &vBands[i];
+                    if ((!b->bEnabled) || (b->bMuted))
+                        continue;
+
+                    for (size_t j=0; j<channels; ++j)
+                    {
+                        const handler_t *h      = &b->vHandlers[j];
+                        if (h->pFunc != NULL)
+                            h->pFunc(h->pObject, h->pSubject, i, &b->vOut[j][nOffset], offset, to_do);
+                    }
+                }
+
+                nOffset                += to_do;
+                offset                 += to_do;
+
+                // Process the frame if the hop is complete
+                if (nOffset >= hop)
+                {
+                    process_frame();
+                    nOffset                 = 0;
+                }
+            }
+        }
+
+        void StereoFFTCrossover::dump(dspu::IStateDumper *v) const
+        {
+            v->write("nRank", nRank);
+            v->write("nMaxRank", nMaxRank);
+            v->write("nBands", nBands);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nOffset", nOffset);
+            v->write("fPhase", fPhase);
+            v->write("bUpdate", bUpdate);
+            v->begin_array("vBands", vBands, nBands);
+            for (size_t i=0; i<nBands; ++i)
+            {
+                const band_t *b = &vBands[i];
+                v->begin_object(b, sizeof(band_t));
+                {
+                    v->write("fHpfFreq", b->fHpfFreq);
+                    v->write("fHpfSlope", b->fHpfSlope);
+                    v->write("fLpfFreq", b->fLpfFreq);
+                    v->write("fLpfSlope", b->fLpfSlope);
+                    v->write("bHpf", b->bHpf);
+                    v->write("bLpf", b->bLpf);
+                    v->write("bEnabled", b->bEnabled);
+                    v->write("bMuted", b->bMuted);
+                    v->write("bClear", b->bClear);
+                    v->write("bUpdate", b->bUpdate);
+                    v->write("vMask", b->vMask);
+                    v->write("vAcc", b->vAcc);
+                    v->writev("vOut", b->vOut, 2);
+                }
+                v->end_object();
+            }
+            v->end_array();
+            v->write("vWindow", vWindow);
+            v->writev("vInBuf", vInBuf, 2);
+            v->write("vFft", vFft);
+            v->write("vTmp", vTmp);
+            v->write("pData", pData);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
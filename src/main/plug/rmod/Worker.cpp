@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <private/rmod/Worker.h>
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+#endif /* PLATFORM_WINDOWS */
+
+#define WORKER_SPIN_COUNT       0x1000
+
+namespace lsp
+{
+    namespace rmod
+    {
+        Worker::Worker()
+        {
+            pThread         = NULL;
+            pTask           = NULL;
+            pArg            = NULL;
+            nSpin           = 0;
+            nPolicy         = 0;
+            nPriority       = 0;
+            bPriority       = false;
+            bApplied        = false;
+            bExit           = false;
+        }
+
+        Worker::~Worker()
+        {
+            stop();
+        }
+
+        status_t Worker::thread_proc(void *arg)
+        {
+            static_cast<Worker *>(arg)->run();
+            return STATUS_OK;
+        }
+
+        void Worker::capture_priority()
+        {
+            bPriority       = true;
+        #ifdef PLATFORM_WINDOWS
+            const int priority      = GetThreadPriority(GetCurrentThread());
+            nPriority       = (priority != THREAD_PRIORITY_ERROR_RETURN) ? priority : THREAD_PRIORITY_NORMAL;
+        #else
+            struct sched_param param;
+            if (pthread_getschedparam(pthread_self(), &nPolicy, &param) == 0)
+                nPriority       = param.sched_priority;
+            else
+                nPolicy         = SCHED_OTHER;
+        #endif /* PLATFORM_WINDOWS */
+        }
+
+        void Worker::apply_priority()
+        {
+            // The audio thread waits for the completion of the task, so the worker should not
+            // be preempted by the threads which do not preempt the audio thread. The failure to
+            // obtain the priority is not considered as an error
+            bApplied        = true;
+        #ifdef PLATFORM_WINDOWS
+            SetThreadPriority(GetCurrentThread(), nPriority);
+        #else
+            if ((nPolicy != SCHED_FIFO) && (nPolicy != SCHED_RR))
+                return;
+
+            struct sched_param param;
+            param.sched_priority    = nPriority;
+            pthread_setschedparam(pthread_self(), nPolicy, &param);
+        #endif /* PLATFORM_WINDOWS */
+        }
+
+        void Worker::run()
+        {
+            while (true)
+            {
+                sRequest.wait(nSpin);
+                if (bExit)
+                    break;
+
+                // The scheduling parameters of the audio thread are published with the first task
+                if (!bApplied)
+                    apply_priority();
+
+                pTask(pArg);
+                sDone.post();
+            }
+        }
+
+        bool Worker::start()
+        {
+            if (pThread != NULL)
+                return true;
+
+            bExit           = false;
+            bApplied        = false;
+            nSpin           = (ipc::Thread::system_cores() > 1) ? WORKER_SPIN_COUNT : 0;
+            sRequest.reset();
+            sDone.reset();
+
+            ipc::Thread *thread = new ipc::Thread(thread_proc, this);
+            if (thread == NULL)
+                return false;
+            if (thread->start() != STATUS_OK)
+            {
+                delete thread;
+                return false;
+            }
+
+            pThread         = thread;
+            return true;
+        }
+
+        void Worker::stop()
+        {
+            if (pThread == NULL)
+                return;
+
+            bExit           = true;
+            sRequest.post();
+            pThread->join();
+
+            delete pThread;
+            pThread         = NULL;
+        }
+
+        void Worker::submit(task_t task, void *arg)
+        {
+            if (!bPriority)
+                capture_priority();
+
+            pTask           = task;
+            pArg            = arg;
+            sRequest.post();
+        }
+
+        void Worker::wait()
+        {
+            sDone.wait(nSpin);
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/rmod/dsp.h>
+
+#ifdef __ARM_NEON
+
+#include <arm_neon.h>
+#include <float.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+        namespace neon
+        {
+            typedef struct follower_x4_t
+            {
+                float32x4_t         peak;
+                float32x4_t         tau;
+                float32x4_t         gain;
+                int32x4_t           hold;
+                int32x4_t           hold_max;
+            } follower_x4_t;
+
+            static inline float32x4_t follow_step(follower_x4_t *f, float32x4_t x)
+            {
+                const float32x4_t s     = vmulq_f32(vabsq_f32(x), f->gain);
+                const uint32x4_t below  = vcltq_f32(s, f->peak);
+                const float32x4_t rel   = vmlaq_f32(f->peak, vsubq_f32(s, f->peak), f->tau);
+                const uint32x4_t hold   = vcgtq_s32(f->hold, vdupq_n_s32(0));
+                const float32x4_t held  = vbslq_f32(hold, f->peak, rel);
+                const float32x4_t out   = vbslq_f32(below, held, s);
+
+                // hold = (below) ? hold - (hold > 0) : hold_max
+                f->hold                 = vbslq_s32(below, vaddq_s32(f->hold, vreinterpretq_s32_u32(hold)), f->hold_max);
+                f->peak                 = out;
+
+                return out;
+            }
+
+            static inline void transpose_4x4(float32x4_t &r0, float32x4_t &r1, float32x4_t &r2, float32x4_t &r3)
+            {
+                const float32x4x2_t t0  = vtrnq_f32(r0, r1);
+                const float32x4x2_t t1  = vtrnq_f32(r2, r3);
+
+                r0                      = vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0]));
+                r1                      = vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1]));
+                r2                      = vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0]));
+                r3                      = vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1]));
+            }
+
+            static void follow_x4(float * const *env, const follower_t *f, float gain, size_t samples)
+            {
+                follower_x4_t x;
+                x.peak              = vld1q_f32(f->vPeak);
+                x.tau               = vld1q_f32(f->vTau);
+                x.gain              = vdupq_n_f32(gain);
+                x.hold              = vreinterpretq_s32_u32(vld1q_u32(f->vHold));
+                x.hold_max          = vreinterpretq_s32_u32(vld1q_u32(f->vHoldMax));
+
+                float * const p0    = env[0];
+                float * const p1    = env[1];
+                float * const p2    = env[2];
+                float * const p3    = env[3];
+
+                // Process 4 samples of each lane at a time: transpose the 4x4 matrix
+                // so each row contains the same sample for all lanes
+                size_t i = 0;
+                for (; i + 4 <= samples; i += 4)
+                {
+                    float32x4_t r0      = vld1q_f32(&p0[i]);
+                    float32x4_t r1      = vld1q_f32(&p1[i]);
+                    float32x4_t r2      = vld1q_f32(&p2[i]);
+                    float32x4_t r3      = vld1q_f32(&p3[i]);
+
+                    transpose_4x4(r0, r1, r2, r3);
+                    r0                  = follow_step(&x, r0);
+                    r1                  = follow_step(&x, r1);
+                    r2                  = follow_step(&x, r2);
+                    r3                  = follow_step(&x, r3);
+                    transpose_4x4(r0, r1, r2, r3);
+
+                    vst1q_f32(&p0[i], r0);
+                    vst1q_f32(&p1[i], r1);
+                    vst1q_f32(&p2[i], r2);
+                    vst1q_f32(&p3[i], r3);
+                }
+
+                // Process the tail sample by sample
+                for (; i < samples; ++i)
+                {
+                    float v[4] __lsp_aligned16 = { p0[i], p1[i], p2[i], p3[i] };
+                    vst1q_f32(v, follow_step(&x, vld1q_f32(v)));
+                    p0[i]               = v[0];
+                    p1[i]               = v[1];
+                    p2[i]               = v[2];
+                    p3[i]               = v[3];
+                }
+
+                vst1q_f32(f->vPeak, x.peak);
+                vst1q_u32(f->vHold, vreinterpretq_u32_s32(x.hold));
+            }
+
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples)
+            {
+                size_t i = 0;
+                for (; i + 4 <= lanes; i += 4)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    follow_x4(&env[i], &xf, gain, samples);
+                }
+
+                if (i < lanes)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    generic::follow_envelope(&env[i], &xf, gain, lanes - i, samples);
+                }
+            }
+
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count)
+            {
+                const float32x4_t a     = vdupq_n_f32(m->fA);
+                const float32x4_t b     = vdupq_n_f32(m->fB);
+                const float32x4_t kin   = vdupq_n_f32(m->fIn);
+                const float32x4_t kdry  = vdupq_n_f32(m->fDry);
+                const float32x4_t kwet  = vdupq_n_f32(m->fWet);
+                const float32x4_t zero  = vdupq_n_f32(0.0f);
+                float32x4_t vmin        = vdupq_n_f32(FLT_MAX);
+
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    const float32x4_t s0    = vld1q_f32(&src[i]);
+                    const float32x4_t s1    = vld1q_f32(&src[i + 4]);
+                    const float32x4_t g0    = vmaxq_f32(zero, vmlaq_f32(a, vld1q_f32(&env[i]), b));
+                    const float32x4_t g1    = vmaxq_f32(zero, vmlaq_f32(a, vld1q_f32(&env[i + 4]), b));
+
+                    vst1q_f32(&in[i], vmlaq_f32(vld1q_f32(&in[i]), s0, kin));
+                    vst1q_f32(&in[i + 4], vmlaq_f32(vld1q_f32(&in[i + 4]), s1, kin));
+                    vst1q_f32(&out[i], vmlaq_f32(vld1q_f32(&out[i]), s0, vmlaq_f32(kdry, kwet, g0)));
+                    vst1q_f32(&out[i + 4], vmlaq_f32(vld1q_f32(&out[i + 4]), s1, vmlaq_f32(kdry, kwet, g1)));
+                    vmin                    = vminq_f32(vmin, vminq_f32(g0, g1));
+                }
+
+                // Reduce the minimum
+                float32x2_t xmin        = vmin_f32(vget_low_f32(vmin), vget_high_f32(vmin));
+                xmin                    = vpmin_f32(xmin, xmin);
+
+                // Process the tail
+                float min               = vget_lane_f32(xmin, 0);
+                if (i < count)
+                {
+                    const float tail    = generic::mix_band(&in[i], &out[i], &src[i], &env[i], m, count - i);
+                    min                 = lsp_min(min, tail);
+                }
+
+                return min;
+            }
+
+            void link_envelopes(float *l, float *r, float link, size_t count)
+            {
+                const float32x4_t k     = vdupq_n_f32(link);
+
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    const float32x4_t l0    = vld1q_f32(&l[i]);
+                    const float32x4_t l1    = vld1q_f32(&l[i + 4]);
+                    const float32x4_t r0    = vld1q_f32(&r[i]);
+                    const float32x4_t r1    = vld1q_f32(&r[i + 4]);
+                    const float32x4_t m0    = vmaxq_f32(l0, r0);
+                    const float32x4_t m1    = vmaxq_f32(l1, r1);
+
+                    vst1q_f32(&l[i], vmlaq_f32(l0, vsubq_f32(m0, l0), k));
+                    vst1q_f32(&l[i + 4], vmlaq_f32(l1, vsubq_f32(m1, l1), k));
+                    vst1q_f32(&r[i], vmlaq_f32(r0, vsubq_f32(m0, r0), k));
+                    vst1q_f32(&r[i + 4], vmlaq_f32(r1, vsubq_f32(m1, r1), k));
+                }
+
+                if (i < count)
+                    generic::link_envelopes(&l[i], &r[i], link, count - i);
+            }
+
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count)
+            {
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    const float32x4_t k0    = vdupq_n_f32(k[0]);
+                    float32x4_t s0          = vmulq_f32(vld1q_f32(&src[0][i]), k0);
+                    float32x4_t s1          = vmulq_f32(vld1q_f32(&src[0][i + 4]), k0);
+
+                    for (size_t j=1; j<n; ++j)
+                    {
+                        const float32x4_t kj    = vdupq_n_f32(k[j]);
+                        s0                      = vmlaq_f32(s0, vld1q_f32(&src[j][i]), kj);
+                        s1                      = vmlaq_f32(s1, vld1q_f32(&src[j][i + 4]), kj);
+                    }
+
+                    vst1q_f32(&dst[i], s0);
+                    vst1q_f32(&dst[i + 4], s1);
+                }
+
+                for (; i < count; ++i)
+                {
+                    float s                 = src[0][i] * k[0];
+                    for (size_t j=1; j<n; ++j)
+                        s                      += src[j][i] * k[j];
+                    dst[i]                  = s;
+                }
+            }
+        } /* namespace neon */
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* __ARM_NEON */
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/rmod/dsp.h>
+
+#include <float.h>
+#include <math.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+            void link_envelopes(float *l, float *r, float link, size_t count);
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+            void link_envelopes(float *l, float *r, float link, size_t count);
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+            void link_envelopes(float *l, float *r, float link, size_t count);
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+
+        namespace generic
+        {
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples)
+            {
+                for (size_t i=0; i<lanes; ++i)
+                {
+                    float * const dst       = env[i];
+                    const float tau         = f->vTau[i];
+                    const uint32_t hold_max = f->vHoldMax[i];
+                    float peak              = f->vPeak[i];
+                    uint32_t hold           = f->vHold[i];
+
+                    for (size_t j=0; j<samples; ++j)
+                    {
+                        float s             = fabsf(dst[j] * gain);  // Rectify input
+                        if (peak > s)
+                        {
+                            // Current rectified sample is below the peak value
+                            if (hold > 0)
+                            {
+                                s                   = peak;             // Hold peak value
+                                --hold;
+                            }
+                            else
+                                s                   = peak + (s - peak) * tau;
+                        }
+                        else
+                            hold                = hold_max;             // Reset hold counter
+
+                        peak                = s;
+                        dst[j]              = s;
+                    }
+
+                    f->vPeak[i]         = peak;
+                    f->vHold[i]         = hold;
+                }
+            }
+
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count)
+            {
+                float min       = FLT_MAX;
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float s   = src[i];
+                    const float g   = lsp_max(0.0f, m->fA + env[i] * m->fB);
+                    in[i]          += s * m->fIn;
+                    out[i]         += s * (m->fDry + m->fWet * g);
+                    min             = lsp_min(min, g);
+                }
+
+                return min;
+            }
+
+            void link_envelopes(float *l, float *r, float link, size_t count)
+            {
+                // The higher envelope does not change since (m - x) is zero for it
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float ls  = l[i];
+                    const float rs  = r[i];
+                    const float m   = lsp_max(ls, rs);
+                    l[i]            = ls + (m - ls) * link;
+                    r[i]            = rs + (m - rs) * link;
+                }
+            }
+
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    float s         = src[0][i] * k[0];
+                    for (size_t j=1; j<n; ++j)
+                        s              += src[j][i] * k[j];
+                    dst[i]          = s;
+                }
+            }
+        } /* namespace generic */
+
+        void (* follow_envelope)(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples) = generic::follow_envelope;
+        float (* mix_band)(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count) = generic::mix_band;
+        void (* link_envelopes)(float *l, float *r, float link, size_t count) = generic::link_envelopes;
+        void (* mix_sources)(float *dst, const float * const *src, const float *k, size_t n, size_t count) = generic::mix_sources;
+
+        void init()
+        {
+        #ifdef ARCH_X86
+            if (avx2::supported())
+            {
+                follow_envelope     = avx2::follow_envelope;
+                mix_band            = avx2::mix_band;
+                link_envelopes      = avx2::link_envelopes;
+                mix_sources         = avx2::mix_sources;
+            }
+            else if (sse2::supported())
+            {
+                follow_envelope     = sse2::follow_envelope;
+                mix_band            = sse2::mix_band;
+                link_envelopes      = sse2::link_envelopes;
+                mix_sources         = sse2::mix_sources;
+            }
+        #elif defined(__ARM_NEON)
+            follow_envelope     = neon::follow_envelope;
+            mix_band            = neon::mix_band;
+            link_envelopes      = neon::link_envelopes;
+            mix_sources         = neon::mix_sources;
+        #endif /* ARCH_X86 */
+        }
+
+    } /* namespace rmod */
+} /* namespace lsp */
@@ -0,0 +1,556 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/rmod/dsp.h>
+
+#ifdef ARCH_X86
+
+#include <float.h>
+#include <immintrin.h>
+
+#define RMOD_SSE2_TARGET        __attribute__((target("sse2")))
+#define RMOD_AVX2_TARGET        __attribute__((target("avx2")))
+
+namespace lsp
+{
+    namespace rmod
+    {
+        namespace sse2
+        {
+            typedef struct follower_x4_t
+            {
+                __m128              peak;
+                __m128              tau;
+                __m128              gain;
+                __m128              sign;
+                __m128i             hold;
+                __m128i             hold_max;
+            } follower_x4_t;
+
+            bool supported()
+            {
+            #ifdef ARCH_X86_64
+                return true;
+            #else
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("sse2");
+            #endif /* ARCH_X86_64 */
+            }
+
+            static inline RMOD_SSE2_TARGET __m128 follow_step(follower_x4_t *f, __m128 x)
+            {
+                const __m128 s      = _mm_mul_ps(_mm_andnot_ps(f->sign, x), f->gain);
+                const __m128 below  = _mm_cmplt_ps(s, f->peak);
+                const __m128 rel    = _mm_add_ps(f->peak, _mm_mul_ps(_mm_sub_ps(s, f->peak), f->tau));
+                const __m128i ihold = _mm_cmpgt_epi32(f->hold, _mm_setzero_si128());
+                const __m128 hold   = _mm_castsi128_ps(ihold);
+                const __m128 held   = _mm_or_ps(_mm_and_ps(hold, f->peak), _mm_andnot_ps(hold, rel));
+                const __m128 out    = _mm_or_ps(_mm_and_ps(below, held), _mm_andnot_ps(below, s));
+                const __m128i ibelow= _mm_castps_si128(below);
+
+                // hold = (below) ? hold - (hold > 0) : hold_max
+                f->hold             = _mm_or_si128(
+                    _mm_and_si128(ibelow, _mm_add_epi32(f->hold, ihold)),
+                    _mm_andnot_si128(ibelow, f->hold_max));
+                f->peak             = out;
+
+                return out;
+            }
+
+            /**
+             * Process N groups of 4 lanes. The recurrence of the follower is latency-bound,
+             * so processing of several independent groups in one loop allows the CPU to
+             * overlap their dependency chains.
+             */
+            template <size_t N>
+            static RMOD_SSE2_TARGET void follow_x4(float * const *env, const follower_t *f, float gain, size_t samples)
+            {
+                follower_x4_t x[N];
+                for (size_t k=0; k<N; ++k)
+                {
+                    const size_t l      = k * 4;
+                    x[k].peak           = _mm_loadu_ps(&f->vPeak[l]);
+                    x[k].tau            = _mm_loadu_ps(&f->vTau[l]);
+                    x[k].gain           = _mm_set1_ps(gain);
+                    x[k].sign           = _mm_set1_ps(-0.0f);
+                    x[k].hold           = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&f->vHold[l]));
+                    x[k].hold_max       = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&f->vHoldMax[l]));
+                }
+
+                // Process 4 samples of each lane at a time: transpose the 4x4 matrix
+                // so each row contains the same sample for all lanes
+                size_t i = 0;
+                for (; i + 4 <= samples; i += 4)
+                {
+                    for (size_t k=0; k<N; ++k)
+                    {
+                        float * const *p    = &env[k * 4];
+                        __m128 r0           = _mm_loadu_ps(&p[0][i]);
+                        __m128 r1           = _mm_loadu_ps(&p[1][i]);
+                        __m128 r2           = _mm_loadu_ps(&p[2][i]);
+                        __m128 r3           = _mm_loadu_ps(&p[3][i]);
+
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                        r0                  = follow_step(&x[k], r0);
+                        r1                  = follow_step(&x[k], r1);
+                        r2                  = follow_step(&x[k], r2);
+                        r3                  = follow_step(&x[k], r3);
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                        _mm_storeu_ps(&p[0][i], r0);
+                        _mm_storeu_ps(&p[1][i], r1);
+                        _mm_storeu_ps(&p[2][i], r2);
+                        _mm_storeu_ps(&p[3][i], r3);
+                    }
+                }
+
+                // Process the tail sample by sample
+                for (; i < samples; ++i)
+                {
+                    for (size_t k=0; k<N; ++k)
+                    {
+                        float * const *p    = &env[k * 4];
+                        float v[4] __lsp_aligned16;
+                        const __m128 r      = follow_step(&x[k], _mm_setr_ps(p[0][i], p[1][i], p[2][i], p[3][i]));
+                        _mm_store_ps(v, r);
+                        for (size_t j=0; j<4; ++j)
+                            p[j][i]             = v[j];
+                    }
+                }
+
+                for (size_t k=0; k<N; ++k)
+                {
+                    const size_t l      = k * 4;
+                    _mm_storeu_ps(&f->vPeak[l], x[k].peak);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(&f->vHold[l]), x[k].hold);
+                }
+            }
+
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples)
+            {
+                size_t i = 0;
+                for (; i + 8 <= lanes; i += 8)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    follow_x4<2>(&env[i], &xf, gain, samples);
+                }
+                for (; i + 4 <= lanes; i += 4)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    follow_x4<1>(&env[i], &xf, gain, samples);
+                }
+
+                if (i < lanes)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    generic::follow_envelope(&env[i], &xf, gain, lanes - i, samples);
+                }
+            }
+
+            RMOD_SSE2_TARGET float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count)
+            {
+                const __m128 a      = _mm_set1_ps(m->fA);
+                const __m128 b      = _mm_set1_ps(m->fB);
+                const __m128 kin    = _mm_set1_ps(m->fIn);
+                const __m128 kdry   = _mm_set1_ps(m->fDry);
+                const __m128 kwet   = _mm_set1_ps(m->fWet);
+                __m128 vmin         = _mm_set1_ps(FLT_MAX);
+
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    const __m128 s0     = _mm_loadu_ps(&src[i]);
+                    const __m128 s1     = _mm_loadu_ps(&src[i + 4]);
+                    const __m128 g0     = _mm_max_ps(_mm_setzero_ps(), _mm_add_ps(a, _mm_mul_ps(_mm_loadu_ps(&env[i]), b)));
+                    const __m128 g1     = _mm_max_ps(_mm_setzero_ps(), _mm_add_ps(a, _mm_mul_ps(_mm_loadu_ps(&env[i + 4]), b)));
+
+                    _mm_storeu_ps(&in[i], _mm_add_ps(_mm_loadu_ps(&in[i]), _mm_mul_ps(s0, kin)));
+                    _mm_storeu_ps(&in[i + 4], _mm_add_ps(_mm_loadu_ps(&in[i + 4]), _mm_mul_ps(s1, kin)));
+                    _mm_storeu_ps(&out[i], _mm_add_ps(_mm_loadu_ps(&out[i]), _mm_mul_ps(s0, _mm_add_ps(kdry, _mm_mul_ps(kwet, g0)))));
+                    _mm_storeu_ps(&out[i + 4], _mm_add_ps(_mm_loadu_ps(&out[i + 4]), _mm_mul_ps(s1, _mm_add_ps(kdry, _mm_mul_ps(kwet, g1)))));
+                    vmin                = _mm_min_ps(vmin, _mm_min_ps(g0, g1));
+                }
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m128 s0     = _mm_loadu_ps(&src[i]);
+                    const __m128 g0     = _mm_max_ps(_mm_setzero_ps(), _mm_add_ps(a, _mm_mul_ps(_mm_loadu_ps(&env[i]), b)));
+
+                    _mm_storeu_ps(&in[i], _mm_add_ps(_mm_loadu_ps(&in[i]), _mm_mul_ps(s0, kin)));
+                    _mm_storeu_ps(&out[i], _mm_add_ps(_mm_loadu_ps(&out[i]), _mm_mul_ps(s0, _mm_add_ps(kdry, _mm_mul_ps(kwet, g0)))));
+                    vmin                = _mm_min_ps(vmin, g0);
+                }
+
+                // Reduce the minimum
+                vmin                = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+                vmin                = _mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(1, 1, 1, 1)));
+
+                // Process the tail
+                float min           = _mm_cvtss_f32(vmin);
+                if (i < count)
+                {
+                    const float tail    = generic::mix_band(&in[i], &out[i], &src[i], &env[i], m, count - i);
+                    min                 = lsp_min(min, tail);
+                }
+
+                return min;
+            }
+
+            RMOD_SSE2_TARGET void link_envelopes(float *l, float *r, float link, size_t count)
+            {
+                const __m128 k      = _mm_set1_ps(link);
+
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    const __m128 l0     = _mm_loadu_ps(&l[i]);
+                    const __m128 l1     = _mm_loadu_ps(&l[i + 4]);
+                    const __m128 r0     = _mm_loadu_ps(&r[i]);
+                    const __m128 r1     = _mm_loadu_ps(&r[i + 4]);
+                    const __m128 m0     = _mm_max_ps(l0, r0);
+                    const __m128 m1     = _mm_max_ps(l1, r1);
+
+                    _mm_storeu_ps(&l[i], _mm_add_ps(l0, _mm_mul_ps(_mm_sub_ps(m0, l0), k)));
+                    _mm_storeu_ps(&l[i + 4], _mm_add_ps(l1, _mm_mul_ps(_mm_sub_ps(m1, l1), k)));
+                    _mm_storeu_ps(&r[i], _mm_add_ps(r0, _mm_mul_ps(_mm_sub_ps(m0, r0), k)));
+                    _mm_storeu_ps(&r[i + 4], _mm_add_ps(r1, _mm_mul_ps(_mm_sub_ps(m1, r1), k)));
+                }
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m128 l0     = _mm_loadu_ps(&l[i]);
+                    const __m128 r0     = _mm_loadu_ps(&r[i]);
+                    const __m128 m0     = _mm_max_ps(l0, r0);
+
+                    _mm_storeu_ps(&l[i], _mm_add_ps(l0, _mm_mul_ps(_mm_sub_ps(m0, l0), k)));
+                    _mm_storeu_ps(&r[i], _mm_add_ps(r0, _mm_mul_ps(_mm_sub_ps(m0, r0), k)));
+                }
+
+                if (i < count)
+                    generic::link_envelopes(&l[i], &r[i], link, count - i);
+            }
+
+            RMOD_SSE2_TARGET void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count)
+            {
+                size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    const __m128 k0     = _mm_set1_ps(k[0]);
+                    __m128 s0           = _mm_mul_ps(_mm_loadu_ps(&src[0][i]), k0);
+                    __m128 s1           = _mm_mul_ps(_mm_loadu_ps(&src[0][i + 4]), k0);
+
+                    for (size_t j=1; j<n; ++j)
+                    {
+                        const __m128 kj     = _mm_set1_ps(k[j]);
+                        s0                  = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(&src[j][i]), kj));
+                        s1                  = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(&src[j][i + 4]), kj));
+                    }
+
+                    _mm_storeu_ps(&dst[i], s0);
+                    _mm_storeu_ps(&dst[i + 4], s1);
+                }
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 s0           = _mm_mul_ps(_mm_loadu_ps(&src[0][i]), _mm_set1_ps(k[0]));
+                    for (size_t j=1; j<n; ++j)
+                        s0                  = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(&src[j][i]), _mm_set1_ps(k[j])));
+
+                    _mm_storeu_ps(&dst[i], s0);
+                }
+
+                for (; i < count; ++i)
+                {
+                    float s             = src[0][i] * k[0];
+                    for (size_t j=1; j<n; ++j)
+                        s                  += src[j][i] * k[j];
+                    dst[i]              = s;
+                }
+            }
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            typedef struct follower_x8_t
+            {
+                __m256              peak;
+                __m256              tau;
+                __m256              gain;
+                __m256              sign;
+                __m256i             hold;
+                __m256i             hold_max;
+            } follower_x8_t;
+
+            bool supported()
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2");
+            }
+
+            static inline RMOD_AVX2_TARGET __m256 follow_step(follower_x8_t *f, __m256 x)
+            {
+                const __m256 s      = _mm256_mul_ps(_mm256_andnot_ps(f->sign, x), f->gain);
+                const __m256 below  = _mm256_cmp_ps(s, f->peak, _CMP_LT_OQ);
+                const __m256 rel    = _mm256_add_ps(f->peak, _mm256_mul_ps(_mm256_sub_ps(s, f->peak), f->tau));
+                const __m256i ihold = _mm256_cmpgt_epi32(f->hold, _mm256_setzero_si256());
+                const __m256 held   = _mm256_blendv_ps(rel, f->peak, _mm256_castsi256_ps(ihold));
+                const __m256 out    = _mm256_blendv_ps(s, held, below);
+
+                // hold = (below) ? hold - (hold > 0) : hold_max
+                f->hold             = _mm256_blendv_epi8(f->hold_max, _mm256_add_epi32(f->hold, ihold), _mm256_castps_si256(below));
+                f->peak             = out;
+
+                return out;
+            }
+
+            static inline RMOD_AVX2_TARGET void transpose_8x8(
+                __m256 &r0, __m256 &r1, __m256 &r2, __m256 &r3,
+                __m256 &r4, __m256 &r5, __m256 &r6, __m256 &r7)
+            {
+                const __m256 t0     = _mm256_unpacklo_ps(r0, r1);
+                const __m256 t1     = _mm256_unpackhi_ps(r0, r1);
+                const __m256 t2     = _mm256_unpacklo_ps(r2, r3);
+                const __m256 t3     = _mm256_unpackhi_ps(r2, r3);
+                const __m256 t4     = _mm256_unpacklo_ps(r4, r5);
+                const __m256 t5     = _mm256_unpackhi_ps(r4, r5);
+                const __m256 t6     = _mm256_unpacklo_ps(r6, r7);
+                const __m256 t7     = _mm256_unpackhi_ps(r6, r7);
+
+                const __m256 s0     = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s1     = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 s2     = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s3     = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 s4     = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s5     = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 s6     = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s7     = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+                r0                  = _mm256_permute2f128_ps(s0, s4, 0x20);
+                r1                  = _mm256_permute2f128_ps(s1, s5, 0x20);
+                r2                  = _mm256_permute2f128_ps(s2, s6, 0x20);
+                r3                  = _mm256_permute2f128_ps(s3, s7, 0x20);
+                r4                  = _mm256_permute2f128_ps(s0, s4, 0x31);
+                r5                  = _mm256_permute2f128_ps(s1, s5, 0x31);
+                r6                  = _mm256_permute2f128_ps(s2, s6, 0x31);
+                r7                  = _mm256_permute2f128_ps(s3, s7, 0x31);
+            }
+
+            /**
+             * Process N groups of 8 lanes, see sse2::follow_x4 for details
+             */
+            template <size_t N>
+            static RMOD_AVX2_TARGET void follow_x8(float * const *env, const follower_t *f, float gain, size_t samples)
+            {
+                follower_x8_t x[N];
+                for (size_t k=0; k<N; ++k)
+                {
+                    const size_t l      = k * 8;
+                    x[k].peak           = _mm256_loadu_ps(&f->vPeak[l]);
+                    x[k].tau            = _mm256_loadu_ps(&f->vTau[l]);
+                    x[k].gain           = _mm256_set1_ps(gain);
+                    x[k].sign           = _mm256_set1_ps(-0.0f);
+                    x[k].hold           = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&f->vHold[l]));
+                    x[k].hold_max       = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&f->vHoldMax[l]));
+                }
+
+                // Process 8 samples of each lane at a time: transpose the 8x8 matrix
+                // so each row contains the same sample for all lanes
+                size_t i = 0;
+                for (; i + 8 <= samples; i += 8)
+                {
+                    for (size_t k=0; k<N; ++k)
+                    {
+                        float * const *p    = &env[k * 8];
+                        __m256 r0           = _mm256_loadu_ps(&p[0][i]);
+                        __m256 r1           = _mm256_loadu_ps(&p[1][i]);
+                        __m256 r2           = _mm256_loadu_ps(&p[2][i]);
+                        __m256 r3           = _mm256_loadu_ps(&p[3][i]);
+                        __m256 r4           = _mm256_loadu_ps(&p[4][i]);
+                        __m256 r5           = _mm256_loadu_ps(&p[5][i]);
+                        __m256 r6           = _mm256_loadu_ps(&p[6][i]);
+                        __m256 r7           = _mm256_loadu_ps(&p[7][i]);
+
+                        transpose_8x8(r0, r1, r2, r3, r4, r5, r6, r7);
+                        r0                  = follow_step(&x[k], r0);
+                        r1                  = follow_step(&x[k], r1);
+                        r2                  = follow_step(&x[k], r2);
+                        r3                  = follow_step(&x[k], r3);
+                        r4                  = follow_step(&x[k], r4);
+                        r5                  = follow_step(&x[k], r5);
+                        r6                  = follow_step(&x[k], r6);
+                        r7                  = follow_step(&x[k], r7);
+                        transpose_8x8(r0, r1, r2, r3, r4, r5, r6, r7);
+
+                        _mm256_storeu_ps(&p[0][i], r0);
+                        _mm256_storeu_ps(&p[1][i], r1);
+                        _mm256_storeu_ps(&p[2][i], r2);
+                        _mm256_storeu_ps(&p[3][i], r3);
+                        _mm256_storeu_ps(&p[4][i], r4);
+                        _mm256_storeu_ps(&p[5][i], r5);
+                        _mm256_storeu_ps(&p[6][i], r6);
+                        _mm256_storeu_ps(&p[7][i], r7);
+                    }
+                }
+
+                // Process the tail sample by sample
+                for (; i < samples; ++i)
+                {
+                    for (size_t k=0; k<N; ++k)
+                    {
+                        float * const *p    = &env[k * 8];
+                        float v[8] __lsp_aligned32;
+                        const __m256 r      = follow_step(&x[k], _mm256_setr_ps(
+                            p[0][i], p[1][i], p[2][i], p[3][i],
+                            p[4][i], p[5][i], p[6][i], p[7][i]));
+                        _mm256_store_ps(v, r);
+                        for (size_t j=0; j<8; ++j)
+                            p[j][i]             = v[j];
+                    }
+                }
+
+                for (size_t k=0; k<N; ++k)
+                {
+                    const size_t l      = k * 8;
+                    _mm256_storeu_ps(&f->vPeak[l], x[k].peak);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&f->vHold[l]), x[k].hold);
+                }
+            }
+
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples)
+            {
+                size_t i = 0;
+                for (; i + 8 <= lanes; i += 8)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    follow_x8<1>(&env[i], &xf, gain, samples);
+                }
+
+                if (i < lanes)
+                {
+                    const follower_t xf = { &f->vPeak[i], &f->vHold[i], &f->vTau[i], &f->vHoldMax[i] };
+                    sse2::follow_envelope(&env[i], &xf, gain, lanes - i, samples);
+                }
+            }
+
+            RMOD_AVX2_TARGET float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count)
+            {
+                const __m256 a      = _mm256_set1_ps(m->fA);
+                const __m256 b      = _mm256_set1_ps(m->fB);
+                const __m256 kin    = _mm256_set1_ps(m->fIn);
+                const __m256 kdry   = _mm256_set1_ps(m->fDry);
+                const __m256 kwet   = _mm256_set1_ps(m->fWet);
+                __m256 vmin         = _mm256_set1_ps(FLT_MAX);
+
+                size_t i = 0;
+                for (; i + 16 <= count; i += 16)
+                {
+                    const __m256 s0     = _mm256_loadu_ps(&src[i]);
+                    const __m256 s1     = _mm256_loadu_ps(&src[i + 8]);
+                    const __m256 g0     = _mm256_max_ps(_mm256_setzero_ps(), _mm256_add_ps(a, _mm256_mul_ps(_mm256_loadu_ps(&env[i]), b)));
+                    const __m256 g1     = _mm256_max_ps(_mm256_setzero_ps(), _mm256_add_ps(a, _mm256_mul_ps(_mm256_loadu_ps(&env[i + 8]), b)));
+
+                    _mm256_storeu_ps(&in[i], _mm256_add_ps(_mm256_loadu_ps(&in[i]), _mm256_mul_ps(s0, kin)));
+                    _mm256_storeu_ps(&in[i + 8], _mm256_add_ps(_mm256_loadu_ps(&in[i + 8]), _mm256_mul_ps(s1, kin)));
+                    _mm256_storeu_ps(&out[i], _mm256_add_ps(_mm256_loadu_ps(&out[i]), _mm256_mul_ps(s0, _mm256_add_ps(kdry, _mm256_mul_ps(kwet, g0)))));
+                    _mm256_storeu_ps(&out[i + 8], _mm256_add_ps(_mm256_loadu_ps(&out[i + 8]), _mm256_mul_ps(s1, _mm256_add_ps(kdry, _mm256_mul_ps(kwet, g1)))));
+                    vmin                = _mm256_min_ps(vmin, _mm256_min_ps(g0, g1));
+                }
+
+                // Reduce the minimum
+                __m128 xmin         = _mm_min_ps(_mm256_castps256_ps128(vmin), _mm256_extractf128_ps(vmin, 1));
+                xmin                = _mm_min_ps(xmin, _mm_movehl_ps(xmin, xmin));
+                xmin                = _mm_min_ss(xmin, _mm_shuffle_ps(xmin, xmin, _MM_SHUFFLE(1, 1, 1, 1)));
+
+                // Process the tail
+                float min           = _mm_cvtss_f32(xmin);
+                if (i < count)
+                {
+                    const float tail    = sse2::mix_band(&in[i], &out[i], &src[i], &env[i], m, count - i);
+                    min                 = lsp_min(min, tail);
+                }
+
+                return min;
+            }
+
+            RMOD_AVX2_TARGET void link_envelopes(float *l, float *r, float link, size_t count)
+            {
+                const __m256 k      = _mm256_set1_ps(link);
+
+                size_t i = 0;
+                for (; i + 16 <= count; i += 16)
+                {
+                    const __m256 l0     = _mm256_loadu_ps(&l[i]);
+                    const __m256 l1     = _mm256_loadu_ps(&l[i + 8]);
+                    const __m256 r0     = _mm256_loadu_ps(&r[i]);
+                    const __m256 r1     = _mm256_loadu_ps(&r[i + 8]);
+                    const __m256 m0     = _mm256_max_ps(l0, r0);
+                    const __m256 m1     = _mm256_max_ps(l1, r1);
+
+                    _mm256_storeu_ps(&l[i], _mm256_add_ps(l0, _mm256_mul_ps(_mm256_sub_ps(m0, l0), k)));
+                    _mm256_storeu_ps(&l[i + 8], _mm256_add_ps(l1, _mm256_mul_ps(_mm256_sub_ps(m1, l1), k)));
+                    _mm256_storeu_ps(&r[i], _mm256_add_ps(r0, _mm256_mul_ps(_mm256_sub_ps(m0, r0), k)));
+                    _mm256_storeu_ps(&r[i + 8], _mm256_add_ps(r1, _mm256_mul_ps(_mm256_sub_ps(m1, r1), k)));
+                }
+
+                if (i < count)
+                    sse2::link_envelopes(&l[i], &r[i], link, count - i);
+            }
+
+            RMOD_AVX2_TARGET void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count)
+            {
+                size_t i = 0;
+                for (; i + 16 <= count; i += 16)
+                {
+                    const __m256 k0     = _mm256_set1_ps(k[0]);
+                    __m256 s0           = _mm256_mul_ps(_mm256_loadu_ps(&src[0][i]), k0);
+                    __m256 s1           = _mm256_mul_ps(_mm256_loadu_ps(&src[0][i + 8]), k0);
+
+                    for (size_t j=1; j<n; ++j)
+                    {
+                        const __m256 kj     = _mm256_set1_ps(k[j]);
+                        s0                  = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_loadu_ps(&src[j][i]), kj));
+                        s1                  = _mm256_add_ps(s1, _mm256_mul_ps(_mm256_loadu_ps(&src[j][i + 8]), kj));
+                    }
+
+                    _mm256_storeu_ps(&dst[i], s0);
+                    _mm256_storeu_ps(&dst[i + 8], s1);
+                }
+
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m256 s0           = _mm256_mul_ps(_mm256_loadu_ps(&src[0][i]), _mm256_set1_ps(k[0]));
+                    for (size_t j=1; j<n; ++j)
+                        s0                  = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_loadu_ps(&src[j][i]), _mm256_set1_ps(k[j])));
+
+                    _mm256_storeu_ps(&dst[i], s0);
+                }
+
+                for (; i < count; ++i)
+                {
+                    float s             = src[0][i] * k[0];
+                    for (size_t j=1; j<n; ++j)
+                        s                  += src[j][i] * k[j];
+                    dst[i]              = s;
+                }
+            }
+        } /* namespace avx2 */
+
+    } /* namespace rmod */
+} /* namespace lsp */
+
+#endif /* ARCH_X86 */
@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/test-fw/mtest.h>
+
+#include <private/plugins/mb_ringmod_sc.h>
+#include <private/test/harness.h>
+#include <private/test/render.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Offline file-to-file renderer for the plugin.
+ *
+ * Usage:
+ *   render [options] -i <input.wav> -o <output.wav>
+ *
+ * Options:
+ *   -i <file>          input audio file (mono file selects mono plugin, stereo file selects stereo plugin)
+ *   -s <file>          sidechain audio file
+ *   -l <file>          shared memory link audio file
+ *   -o <file>          output audio file
+ *   -r <file>          reference audio file to compare the output with
+ *   -t <value>         maximum allowed absolute difference between output and reference, default 1e-5
+ *   -c <file>          plugin configuration file (see res/doc/configs)
+ *   -p <id>=<value>    override value of the port, can be specified multiple times
+ *   -b <samples>       host block size, default 1024
+ *   -x <id>[,<id>...]  render once per each value of the listed enumerated ports and report
+ *                      the real-time factor and the difference against the configured output
+ */
+
+#define DEFAULT_BLOCK_SIZE      1024
+#define DEFAULT_TOLERANCE       1e-5f
+
+namespace
+{
+    using namespace lsp;
+
+    typedef struct render_t
+    {
+        const char     *in;
+        const char     *sc;
+        const char     *link;
+        const char     *out;
+        const char     *ref;
+        const char     *config;
+        const char     *sweep;
+        float           tolerance;
+        size_t          block;
+    } render_t;
+
+    typedef struct streams_t
+    {
+        dspu::Sample    in;
+        dspu::Sample    sc;
+        dspu::Sample    link;
+    } streams_t;
+}
+
+MTEST_BEGIN("mb_ringmod_sc", render)
+
+    bool load_sample(dspu::Sample *s, const char *path, size_t sample_rate)
+    {
+        if (path == NULL)
+            return true;
+
+        status_t res = s->load(path);
+        if (res != STATUS_OK)
+        {
+            fprintf(stderr, "Failed to load file %s, error code %d\n", path, int(res));
+            return false;
+        }
+        if ((sample_rate > 0) && (s->sample_rate() != sample_rate))
+        {
+            if ((res = s->resample(sample_rate)) != STATUS_OK)
+            {
+                fprintf(stderr, "Failed to resample file %s, error code %d\n", path, int(res));
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool parse_args(render_t *r, test::PluginHarness *h, int argc, const char **argv)
+    {
+        for (int i=0; i<argc; ++i)
+        {
+            const char *arg = argv[i];
+            const char *val = (i + 1 < argc) ? argv[i+1] : NULL;
+            if ((arg[0] != '-') || (arg[1] == '\0') || (arg[2] != '\0') || (val == NULL))
+            {
+                fprintf(stderr, "Invalid argument: %s\n", arg);
+                return false;
+            }
+
+            ++i;
+            switch (arg[1])
+            {
+                case 'i': r->in         = val; break;
+                case 's': r->sc         = val; break;
+                case 'l': r->link       = val; break;
+                case 'o': r->out        = val; break;
+                case 'r': r->ref        = val; break;
+                case 'c': r->config     = val; break;
+                case 'x': r->sweep      = val; break;
+                case 't': r->tolerance  = atof(val); break;
+                case 'b': r->block      = lsp_max(atoi(val), 1); break;
+                case 'p':
+                {
+                    if (h == NULL)
+                        break;
+                    char buf[256];
+                    strncpy(buf, val, sizeof(buf));
+                    buf[sizeof(buf) - 1] = '\0';
+                    if (!test::apply_assignment(*h, buf))
+                    {
+                        fprintf(stderr, "Invalid port assignment: %s\n", val);
+                        return false;
+                    }
+                    break;
+                }
+                default:
+                    fprintf(stderr, "Unknown option: %s\n", arg);
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Render the input streams with the plugin
+     * @param out output sample, latency-compensated
+     * @param time time spent in process() calls
+     * @param latency the latency reported by the plugin
+     * @param id identifier of the port to override after the configuration is applied, may be NULL
+     * @param value value of the overridden port
+     */
+    void render(dspu::Sample *out, double *time, size_t *latency,
+        render_t *r, streams_t *s, int argc, const char **argv,
+        const char *id, float value)
+    {
+        // Create the plugin
+        const size_t sample_rate    = s->in.sample_rate();
+        const size_t channels       = (s->in.channels() > 1) ? 2 : 1;
+        const meta::plugin_t *meta  = (channels > 1) ? &meta::mb_ringmod_sc_stereo : &meta::mb_ringmod_sc_mono;
+        test::PluginHarness h;
+        MTEST_ASSERT(h.init(new plugins::mb_ringmod_sc(meta), sample_rate, r->block));
+
+        // Configure the plugin: configuration file first, port overrides after
+        if (r->config != NULL)
+            MTEST_ASSERT_MSG(test::load_config(h, r->config), "Failed to load configuration file %s", r->config);
+        MTEST_ASSERT(parse_args(r, &h, argc, argv));
+        if (id != NULL)
+            MTEST_ASSERT(h.set(id, value));
+
+        // Perform the rendering
+        MTEST_ASSERT(test::render(out, latency, time, h, &s->in,
+            (r->sc != NULL) ? &s->sc : NULL,
+            (r->link != NULL) ? &s->link : NULL));
+    }
+
+    /**
+     * Compare the output with the reference
+     * @param out output sample
+     * @param ref reference sample
+     * @return maximum absolute difference between samples over all channels
+     */
+    float compare(const dspu::Sample *out, const dspu::Sample *ref)
+    {
+        float result    = 0.0f;
+        for (size_t i=0; i<out->channels(); ++i)
+        {
+            const float *a  = out->channel(i);
+            const float *b  = ref->channel(i);
+            float max_diff  = 0.0f;
+            double rms      = 0.0;
+            size_t max_pos  = 0;
+
+            for (size_t j=0; j<out->length(); ++j)
+            {
+                const float diff    = fabsf(a[j] - b[j]);
+                rms                += double(diff) * double(diff);
+                if (diff > max_diff)
+                {
+                    max_diff            = diff;
+                    max_pos             = j;
+                }
+            }
+            rms             = sqrt(rms / lsp_max(out->length(), size_t(1)));
+
+            printf("  channel %d: max difference %g at sample %d, RMS difference %g\n",
+                int(i), max_diff, int(max_pos), rms);
+            result          = lsp_max(result, max_diff);
+        }
+
+        return result;
+    }
+
+    void print_stats(const dspu::Sample *out, double time, size_t latency)
+    {
+        const double duration   = double(out->length()) / double(out->sample_rate());
+        printf("Rendered %.3f seconds of audio in %.3f seconds, real-time factor: %.2f, latency: %d samples\n",
+            duration, time, (time > 0.0) ? duration / time : 0.0, int(latency));
+    }
+
+    /**
+     * Render the input once per each value of the enumerated port and compare
+     * the result with the output rendered with the configured value
+     */
+    void sweep(const dspu::Sample *base, const char *id, render_t *r, streams_t *s, int argc, const char **argv)
+    {
+        const meta::plugin_t *meta  = (s->in.channels() > 1) ? &meta::mb_ringmod_sc_stereo : &meta::mb_ringmod_sc_mono;
+        const meta::port_t *port    = NULL;
+        for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+            if (!strcmp(p->id, id))
+            {
+                port        = p;
+                break;
+            }
+        MTEST_ASSERT_MSG(port != NULL, "Unknown port: %s", id);
+        MTEST_ASSERT_MSG(port->items != NULL, "Port %s is not enumerated", id);
+
+        for (size_t i=0; port->items[i].text != NULL; ++i)
+        {
+            dspu::Sample out;
+            double time;
+            size_t latency;
+
+            printf("Sweep %s=%d (%s):\n", id, int(i), port->items[i].text);
+            render(&out, &time, &latency, r, s, argc, argv, id, i);
+            print_stats(&out, time, latency);
+            compare(&out, base);
+        }
+    }
+
+    MTEST_MAIN
+    {
+        render_t r;
+        r.in            = NULL;
+        r.sc            = NULL;
+        r.link          = NULL;
+        r.out           = NULL;
+        r.ref           = NULL;
+        r.config        = NULL;
+        r.sweep         = NULL;
+        r.tolerance     = DEFAULT_TOLERANCE;
+        r.block         = DEFAULT_BLOCK_SIZE;
+
+        // First pass: get file names
+        MTEST_ASSERT(parse_args(&r, NULL, argc, argv));
+        MTEST_ASSERT_MSG(r.in != NULL, "Input file should be specified");
+
+        // Load input files
+        streams_t s;
+        dspu::Sample ref;
+        MTEST_ASSERT(load_sample(&s.in, r.in, 0));
+        const size_t sample_rate    = s.in.sample_rate();
+        MTEST_ASSERT(load_sample(&s.sc, r.sc, sample_rate));
+        MTEST_ASSERT(load_sample(&s.link, r.link, sample_rate));
+        MTEST_ASSERT(load_sample(&ref, r.ref, sample_rate));
+
+        // Render with the configured settings
+        dspu::Sample out;
+        double time;
+        size_t latency;
+        render(&out, &time, &latency, &r, &s, argc, argv, NULL, 0.0f);
+        print_stats(&out, time, latency);
+
+        if (r.out != NULL)
+        {
+            const ssize_t written = out.save(r.out);
+            MTEST_ASSERT_MSG(written >= 0, "Failed to save output file %s", r.out);
+        }
+
+        // Compare with the reference
+        if (r.ref != NULL)
+        {
+            MTEST_ASSERT_MSG(ref.channels() == out.channels(), "Reference has %d channels, expected %d",
+                int(ref.channels()), int(out.channels()));
+            MTEST_ASSERT_MSG(ref.length() == out.length(), "Reference has %d samples, expected %d",
+                int(ref.length()), int(out.length()));
+
+            const float max_diff = compare(&out, &ref);
+            MTEST_ASSERT_MSG(max_diff <= r.tolerance,
+                "Output differs from reference: %g > %g", max_diff, r.tolerance);
+        }
+
+        // Sweep over the values of the listed ports
+        if (r.sweep != NULL)
+        {
+            char ids[256];
+            strncpy(ids, r.sweep, sizeof(ids));
+            ids[sizeof(ids) - 1] = '\0';
+
+            for (char *id = ids; id != NULL; )
+            {
+                char *next = strchr(id, ',');
+                if (next != NULL)
+                    *(next++)   = '\0';
+                sweep(&out, test::trim(id), &r, &s, argc, argv);
+                id          = next;
+            }
+        }
+    }
+
+MTEST_END
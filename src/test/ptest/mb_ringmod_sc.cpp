@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/plugins/mb_ringmod_sc.h>
+#include <private/test/harness.h>
+
+#define MAX_BLOCK_SIZE      8192
+#define STAGE_SECONDS       2
+
+namespace
+{
+    using namespace lsp;
+
+    static const char *mode_names[] =
+    {
+        "iir",
+        "spm",
+        "ll"
+    };
+
+    static const char *stage_names[] =
+    {
+        "premix",
+        "sc_envelope",
+        "signal",
+        "analysis",
+        "meshes"
+    };
+
+    /**
+     * The plugin with access to the internal timing counters
+     */
+    class bench_mb_ringmod_sc: public plugins::mb_ringmod_sc
+    {
+        public:
+            static constexpr size_t STAGES      = STG_TOTAL;
+
+        public:
+            explicit bench_mb_ringmod_sc(const meta::plugin_t *meta): plugins::mb_ringmod_sc(meta) {}
+
+        public:
+            void reset_timings()
+            {
+                for (size_t i=0; i<STG_TOTAL; ++i)
+                    rmod::timing_reset(&vTiming[i]);
+                rmod::timing_reset(&sTiming);
+            }
+
+            inline void set_slice_hint(size_t slice)        { nSliceHint = slice;           }
+            inline size_t slice_size() const                { return nSliceSize;            }
+            inline uint64_t stage_time(size_t stage) const  { return vTiming[stage].nTotal; }
+            inline uint64_t total_time() const              { return sTiming.nTotal;        }
+    };
+
+    typedef struct config_t
+    {
+        const meta::plugin_t   *meta;               // Plugin metadata
+        size_t                  mode;               // Crossover mode
+        size_t                  bands;              // Number of active bands
+        size_t                  slope;              // Crossover slope
+        size_t                  res;                // Linear phase crossover resolution
+        size_t                  part;               // Low latency partition size
+        size_t                  mt;                 // Multi-threaded processing
+        float                   duck;               // Ducking time of each band, ms
+        long                    sample_rate;        // Sample rate
+        size_t                  block;              // Host block size
+        size_t                  slice;              // Processing slice size, zero for automatic selection
+        bool                    ui;                 // UI is attached to the plugin
+    } config_t;
+}
+
+PTEST_BEGIN("mb_ringmod_sc", process, 1, 100)
+
+    void fill_noise(float *dst, size_t count, uint32_t seed)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            seed        = seed * 1664525 + 1013904223;
+            dst[i]      = (float(seed >> 8) / float(1 << 24)) * 2.0f - 1.0f;
+        }
+    }
+
+    void setup(test::PluginHarness &h, const config_t *cfg)
+    {
+        char id[32];
+
+        h.set("mode", cfg->mode);
+        h.set("slope", cfg->slope);
+        h.set("res", cfg->res);
+        h.set("part", cfg->part);
+        h.set("mt", cfg->mt);
+
+        // Enable necessary number of splits, the default split frequencies are already sorted
+        for (size_t i=1; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+        {
+            snprintf(id, sizeof(id), "se_%d", int(i));
+            h.set(id, (i < cfg->bands) ? 1.0f : 0.0f);
+        }
+
+        // Setup ducking for each band
+        for (size_t i=0; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+        {
+            snprintf(id, sizeof(id), "dt_%d", int(i + 1));
+            h.set(id, cfg->duck);
+        }
+
+        // Fill audio inputs with noise
+        static const char *inputs[] = { "in", "in_l", "in_r", "sc", "sc_l", "sc_r", NULL };
+        for (size_t i=0; inputs[i] != NULL; ++i)
+        {
+            float *buf = h.buffer(inputs[i]);
+            if (buf != NULL)
+                fill_noise(buf, h.block_size(), 0x1234 + i);
+        }
+    }
+
+    void call(const config_t *cfg)
+    {
+        test::PluginHarness h;
+        bench_mb_ringmod_sc *plugin = new bench_mb_ringmod_sc(cfg->meta);
+        plugin->set_slice_hint(cfg->slice);
+        if (!h.init(plugin, cfg->sample_rate, MAX_BLOCK_SIZE))
+        {
+            PTEST_FAIL_MSG("Failed to initialize plugin %s", cfg->meta->uid);
+            return;
+        }
+
+        setup(h, cfg);
+        if (cfg->ui)
+            plugin->ui_activated();
+
+        // Warm-up: let all delay lines and crossovers to be filled with data
+        for (size_t n=0; n < size_t(cfg->sample_rate); n += cfg->block)
+            h.process(cfg->block);
+
+        char label[128];
+        snprintf(label, sizeof(label), "%s %s bands=%d slope=%d res=%d part=%d mt=%d duck=%.1f sr=%ld block=%d slice=%d%s",
+            cfg->meta->uid, mode_names[cfg->mode],
+            int(cfg->bands), int(cfg->slope), int(cfg->res), int(cfg->part), int(cfg->mt), cfg->duck,
+            cfg->sample_rate, int(cfg->block),
+            int(plugin->slice_size()), (cfg->ui) ? "" : " headless");
+
+        printf("Testing %s...\n", label);
+        PTEST_LOOP(label,
+            h.process(cfg->block);
+        );
+
+        // Measure the cost of each processing stage
+        size_t total        = 0;
+        plugin->reset_timings();
+        while (total < size_t(cfg->sample_rate) * STAGE_SECONDS)
+        {
+            h.process(cfg->block);
+            total              += cfg->block;
+        }
+
+        const double sum    = plugin->total_time();
+        printf("  total: %.3f ns/sample, DSP load: %.3f%%\n",
+            sum / total, (sum * 1e-7 * cfg->sample_rate) / total);
+        for (size_t i=0; i<bench_mb_ringmod_sc::STAGES; ++i)
+        {
+            const double stage  = plugin->stage_time(i);
+            printf("  %-12s: %.3f ns/sample (%.1f%%)\n",
+                stage_names[i], stage / total, (sum > 0.0) ? stage * 100.0 / sum : 0.0);
+        }
+    }
+
+    PTEST_MAIN
+    {
+        static const meta::plugin_t *plugins[] =
+        {
+            &meta::mb_ringmod_sc_mono,
+            &meta::mb_ringmod_sc_stereo
+        };
+        static const size_t threading[] =
+        {
+            2,      // Off, Pipeline
+            3       // Off, Parallel, Pipeline
+        };
+        static const long sample_rates[] = { 44100, 48000, 88200, 96000, 176400, 192000 };
+
+        for (size_t i=0; i<sizeof(plugins)/sizeof(plugins[0]); ++i)
+        {
+            for (size_t mode=0; mode < 3; ++mode)
+            {
+                config_t cfg;
+                cfg.meta            = plugins[i];
+                cfg.mode            = mode;
+                cfg.bands           = 4;
+                cfg.slope           = 2;
+                cfg.res             = meta::mb_ringmod_sc::FFT_XOVER_RES_DFL;
+                cfg.part            = meta::mb_ringmod_sc::FIR_PART_DFL;
+                cfg.mt              = 0;
+                cfg.duck            = 0.0f;
+                cfg.sample_rate     = 48000;
+                cfg.block           = 512;
+                cfg.slice           = 0;
+                cfg.ui              = true;
+
+                // Number of bands
+                for (size_t bands=1; bands <= meta::mb_ringmod_sc::BANDS_MAX; ++bands)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.bands      = bands;
+                    call(&xcfg);
+                }
+                PTEST_SEPARATOR;
+
+                // Slopes
+                for (size_t slope=0; slope < 4; ++slope)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.slope      = slope;
+                    call(&xcfg);
+                }
+                PTEST_SEPARATOR;
+
+                // Sample rates
+                for (size_t sr=0; sr < sizeof(sample_rates)/sizeof(sample_rates[0]); ++sr)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.sample_rate= sample_rates[sr];
+                    call(&xcfg);
+                }
+                PTEST_SEPARATOR;
+
+                // Block sizes
+                for (size_t block=16; block <= MAX_BLOCK_SIZE; block <<= 1)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.block      = block;
+                    call(&xcfg);
+                }
+                PTEST_SEPARATOR;
+
+                // Slice sizes, zero means automatic selection
+                for (size_t slice=32; slice <= 512; slice <<= 1)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.bands      = meta::mb_ringmod_sc::BANDS_MAX;
+                    xcfg.slice      = (slice < 64) ? 0 : slice;
+                    call(&xcfg);
+                }
+                PTEST_SEPARATOR;
+
+                // Attached UI and headless processing
+                for (size_t ui=0; ui < 2; ++ui)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.ui         = ui > 0;
+                    call(&xcfg);
+                }
+                PTEST_SEPARATOR;
+
+                // Threading modes
+                for (size_t mt=0; mt < threading[i]; ++mt)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.mt         = mt;
+                    call(&xcfg);
+                }
+
+                // Ducking widens the window of the envelope maximum, check it with each threading mode
+                for (size_t mt=0; mt < threading[i]; ++mt)
+                {
+                    config_t xcfg   = cfg;
+                    xcfg.mt         = mt;
+                    xcfg.duck       = 5.0f;
+                    call(&xcfg);
+                }
+
+                // Resolution of the linear phase crossover
+                if (mode != 0)
+                {
+                    PTEST_SEPARATOR;
+                    for (size_t res=0; res < 4; ++res)
+                    {
+                        config_t xcfg   = cfg;
+                        xcfg.res        = res;
+                        call(&xcfg);
+                    }
+                }
+
+                // Partition size of the low latency crossover
+                if (mode == 2)
+                {
+                    PTEST_SEPARATOR;
+                    for (size_t part=0; part < 6; ++part)
+                    {
+                        config_t xcfg   = cfg;
+                        xcfg.part       = part;
+                        call(&xcfg);
+                    }
+                }
+                PTEST_SEPARATOR2;
+            }
+        }
+    }
+
+PTEST_END
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/DenormalGuard.h>
+#include <private/rmod/dsp.h>
+
+#define SAMPLES         0x200
+#define LANES           16
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* follow_envelope_t)(float * const *env, const lsp::rmod::follower_t *f, float gain, size_t lanes, size_t samples);
+
+// Release tail of the envelope follower after the signal stops: the input is silent
+// and each lane starts from the peak value near the denormal range, so the whole
+// block of the release recurrence is computed on the denormal numbers. The time
+// of the guarded run should match the time of the reference run on regular numbers.
+PTEST_BEGIN("mb_ringmod_sc.rmod", denormal_tails, 5, 10000)
+
+    void run(const char *label, float * const *env, const lsp::rmod::follower_t *f, float initial, follow_envelope_t func)
+    {
+        PTEST_LOOP(label,
+            for (size_t i=0; i<LANES; ++i)
+            {
+                lsp::dsp::fill_zero(env[i], SAMPLES);
+                f->vPeak[i]     = initial;
+                f->vHold[i]     = 0;
+            }
+            func(env, f, 1.0f, LANES, SAMPLES);
+        );
+    }
+
+    void call(const char *label, float * const *env, float initial, bool guarded, follow_envelope_t func)
+    {
+        if (!func)
+            return;
+
+        float peak[LANES], tau[LANES];
+        uint32_t hold[LANES], hold_max[LANES];
+        for (size_t i=0; i<LANES; ++i)
+        {
+            tau[i]          = 0.0001f * (i + 1);
+            hold_max[i]     = 0;
+        }
+        const lsp::rmod::follower_t f = { peak, hold, tau, hold_max };
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %s", label, (guarded) ? "guarded" : "unguarded");
+        printf("Testing %s...\n", buf);
+
+        if (guarded)
+        {
+            lsp::rmod::DenormalGuard guard;
+            run(buf, env, &f, initial, func);
+        }
+        else
+            run(buf, env, &f, initial, func);
+    }
+
+    void call(const char *label, float * const *env, follow_envelope_t func)
+    {
+        call(label, env, 1e-39f, false, func);
+        call(label, env, 1e-39f, true, func);
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *buf          = lsp::alloc_aligned<float>(data, SAMPLES * LANES, 64);
+        float *env[LANES];
+        for (size_t i=0; i<LANES; ++i)
+            env[i]              = &buf[i * SAMPLES];
+
+        // Regular numbers as the reference
+        call("generic reference", env, 1e-3f, false, lsp::rmod::generic::follow_envelope);
+        call("generic", env, lsp::rmod::generic::follow_envelope);
+    #ifdef ARCH_X86
+        if (lsp::rmod::sse2::supported())
+            call("sse2", env, lsp::rmod::sse2::follow_envelope);
+        if (lsp::rmod::avx2::supported())
+            call("avx2", env, lsp::rmod::avx2::follow_envelope);
+    #endif /* ARCH_X86 */
+    #ifdef __ARM_NEON
+        call("neon", env, lsp::rmod::neon::follow_envelope);
+    #endif /* __ARM_NEON */
+        PTEST_SEPARATOR;
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/dsp.h>
+
+#include <math.h>
+
+#define SAMPLES         0x200
+#define LANES_MAX       16
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* follow_envelope_t)(float * const *env, const lsp::rmod::follower_t *f, float gain, size_t lanes, size_t samples);
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", follow_envelope, 5, 10000)
+
+    void call(const char *label, float * const *env, const float *src, size_t lanes, follow_envelope_t func)
+    {
+        if (!func)
+            return;
+
+        float peak[LANES_MAX], tau[LANES_MAX];
+        uint32_t hold[LANES_MAX], hold_max[LANES_MAX];
+        for (size_t i=0; i<lanes; ++i)
+        {
+            peak[i]         = 0.0f;
+            hold[i]         = 0;
+            tau[i]          = 0.01f * (i + 1);
+            hold_max[i]     = 16 * i;
+        }
+        const lsp::rmod::follower_t f = { peak, hold, tau, hold_max };
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", label, int(lanes));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<lanes; ++i)
+                lsp::dsp::copy(env[i], &src[i * SAMPLES], SAMPLES);
+            func(env, &f, 1.0f, lanes, SAMPLES);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *src          = lsp::alloc_aligned<float>(data, SAMPLES * LANES_MAX * 2, 64);
+        float *env[LANES_MAX];
+
+        // Fill lanes with the amplitude-modulated sine waves of different frequencies
+        for (size_t i=0; i<LANES_MAX; ++i)
+        {
+            env[i]              = &src[(LANES_MAX + i) * SAMPLES];
+            const float w       = 2.0f * M_PI * 40.0f * powf(2.0f, i * 0.7f) / 48000.0f;
+            for (size_t j=0; j<SAMPLES; ++j)
+                src[i * SAMPLES + j]    = sinf(w * j) * (0.5f + 0.5f * sinf(j * 0.01f));
+        }
+
+        static const size_t lanes[] = { 1, 2, 4, 8, 16 };
+        for (size_t i=0; i<sizeof(lanes)/sizeof(lanes[0]); ++i)
+        {
+            call("generic", env, src, lanes[i], lsp::rmod::generic::follow_envelope);
+        #ifdef ARCH_X86
+            if (lsp::rmod::sse2::supported())
+                call("sse2", env, src, lanes[i], lsp::rmod::sse2::follow_envelope);
+            if (lsp::rmod::avx2::supported())
+                call("avx2", env, src, lanes[i], lsp::rmod::avx2::follow_envelope);
+        #endif /* ARCH_X86 */
+        #ifdef __ARM_NEON
+            call("neon", env, src, lanes[i], lsp::rmod::neon::follow_envelope);
+        #endif /* __ARM_NEON */
+            PTEST_SEPARATOR;
+        }
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/dsp.h>
+
+#include <math.h>
+
+#define SAMPLES         0x200
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void link_envelopes(float *l, float *r, float link, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void link_envelopes(float *l, float *r, float link, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void link_envelopes(float *l, float *r, float link, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* link_envelopes_t)(float *l, float *r, float link, size_t count);
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", link_envelopes, 5, 10000)
+
+    void call(const char *label, float *l, float *r, size_t count, link_envelopes_t func)
+    {
+        if (!func)
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", label, int(count));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(l, r, 0.5f, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *l            = lsp::alloc_aligned<float>(data, SAMPLES * 2, 64);
+        float *r            = &l[SAMPLES];
+
+        // Envelopes cross each other, so each channel is the minimum one for some samples
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            l[i]                = fabsf(sinf(i * 0.01f));
+            r[i]                = fabsf(cosf(i * 0.013f));
+        }
+
+        for (size_t count=16; count <= SAMPLES; count <<= 1)
+        {
+            call("generic", l, r, count, lsp::rmod::generic::link_envelopes);
+        #ifdef ARCH_X86
+            if (lsp::rmod::sse2::supported())
+                call("sse2", l, r, count, lsp::rmod::sse2::link_envelopes);
+            if (lsp::rmod::avx2::supported())
+                call("avx2", l, r, count, lsp::rmod::avx2::link_envelopes);
+        #endif /* ARCH_X86 */
+        #ifdef __ARM_NEON
+            call("neon", l, r, count, lsp::rmod::neon::link_envelopes);
+        #endif /* __ARM_NEON */
+            PTEST_SEPARATOR;
+        }
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/dsp.h>
+
+#include <math.h>
+
+#define SAMPLES         0x200
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef float (* mix_band_t)(float *in, float *out, const float *src, const float *env, const lsp::rmod::band_mix_t *m, size_t count);
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", mix_band, 5, 10000)
+
+    void call(const char *label, float *in, float *out, const float *src, const float *env, size_t count, mix_band_t func)
+    {
+        if (!func)
+            return;
+
+        const lsp::rmod::band_mix_t m = { 1.0f, -0.5f, 1.0f, 0.25f, 0.75f };
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", label, int(count));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(in, out, src, env, &m, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *in           = lsp::alloc_aligned<float>(data, SAMPLES * 4, 64);
+        float *out          = &in[SAMPLES];
+        float *src          = &out[SAMPLES];
+        float *env          = &src[SAMPLES];
+
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            in[i]               = 0.0f;
+            out[i]              = 0.0f;
+            src[i]              = sinf(i * 0.1f);
+            env[i]              = fabsf(sinf(i * 0.01f));
+        }
+
+        for (size_t count=16; count <= SAMPLES; count <<= 1)
+        {
+            call("generic", in, out, src, env, count, lsp::rmod::generic::mix_band);
+        #ifdef ARCH_X86
+            if (lsp::rmod::sse2::supported())
+                call("sse2", in, out, src, env, count, lsp::rmod::sse2::mix_band);
+            if (lsp::rmod::avx2::supported())
+                call("avx2", in, out, src, env, count, lsp::rmod::avx2::mix_band);
+        #endif /* ARCH_X86 */
+        #ifdef __ARM_NEON
+            call("neon", in, out, src, env, count, lsp::rmod::neon::mix_band);
+        #endif /* __ARM_NEON */
+            PTEST_SEPARATOR;
+        }
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/dsp.h>
+
+#include <stdlib.h>
+
+#define SAMPLES         0x200
+#define SOURCES         6
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* mix_sources_t)(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", mix_sources, 5, 10000)
+
+    void call(const char *label, float *dst, const float * const *src, const float *k, size_t n, size_t count, mix_sources_t func)
+    {
+        if (!func)
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s n=%d x%d", label, int(n), int(count));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, src, k, n, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *dst          = lsp::alloc_aligned<float>(data, SAMPLES * (SOURCES + 1), 64);
+        const float *src[SOURCES];
+        float k[SOURCES];
+
+        for (size_t i=0; i<SOURCES; ++i)
+        {
+            float *buf          = &dst[SAMPLES * (i + 1)];
+            for (size_t j=0; j<SAMPLES; ++j)
+                buf[j]              = float(rand()) / RAND_MAX - 0.5f;
+            src[i]              = buf;
+            k[i]                = float(rand()) / RAND_MAX;
+        }
+
+        // Two sources: sidechain with pre-mix, six sources: mid/side of fully pre-mixed stereo signal
+        for (size_t n=2; n <= SOURCES; n += 4)
+        {
+            for (size_t count=16; count <= SAMPLES; count <<= 1)
+            {
+                call("generic", dst, src, k, n, count, lsp::rmod::generic::mix_sources);
+            #ifdef ARCH_X86
+                if (lsp::rmod::sse2::supported())
+                    call("sse2", dst, src, k, n, count, lsp::rmod::sse2::mix_sources);
+                if (lsp::rmod::avx2::supported())
+                    call("avx2", dst, src, k, n, count, lsp::rmod::avx2::mix_sources);
+            #endif /* ARCH_X86 */
+            #ifdef __ARM_NEON
+                call("neon", dst, src, k, n, count, lsp::rmod::neon::mix_sources);
+            #endif /* __ARM_NEON */
+                PTEST_SEPARATOR;
+            }
+        }
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
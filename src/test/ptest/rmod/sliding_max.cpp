@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/RingBuffer.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/SlidingMax.h>
+
+#include <stdlib.h>
+
+#define SAMPLES         0x2000
+#define BLOCK_SIZE      0x200
+#define DELAY_MAX       0x1000
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", sliding_max, 5, 1000)
+
+    // Maximum of three taps of the delay line: the latency, the lookahead and the duck delays
+    void call_taps(size_t window, const float *in, float *out, float *tmp)
+    {
+        lsp::dspu::RingBuffer rb;
+        rb.init(DELAY_MAX + BLOCK_SIZE);
+
+        const size_t lookahead  = 0;
+        const size_t latency    = window >> 1;
+        const size_t duck       = window - 1;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "taps window=%d", int(window));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<SAMPLES; i += BLOCK_SIZE)
+            {
+                rb.append(&in[i], BLOCK_SIZE);
+                rb.get(out, BLOCK_SIZE + latency, BLOCK_SIZE);
+                rb.get(tmp, BLOCK_SIZE + lookahead, BLOCK_SIZE);
+                lsp::dsp::pmax2(out, tmp, BLOCK_SIZE);
+                rb.get(tmp, BLOCK_SIZE + duck, BLOCK_SIZE);
+                lsp::dsp::pmax2(out, tmp, BLOCK_SIZE);
+            }
+        );
+
+        rb.destroy();
+    }
+
+    // True maximum over the whole window
+    void call_window(size_t window, const float *in, float *out)
+    {
+        lsp::rmod::SlidingMax sm;
+        sm.init(DELAY_MAX);
+        sm.set_window(window);
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "window=%d", int(window));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<SAMPLES; i += BLOCK_SIZE)
+                sm.process(out, &in[i], BLOCK_SIZE);
+        );
+
+        sm.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *in           = lsp::alloc_aligned<float>(data, SAMPLES + BLOCK_SIZE * 2, 64);
+        float *out          = &in[SAMPLES];
+        float *tmp          = &out[BLOCK_SIZE];
+
+        for (size_t i=0; i<SAMPLES; ++i)
+            in[i]               = float(rand()) / RAND_MAX;
+
+        static const size_t windows[] = { 16, 64, 256, 1024, 4096 };
+        for (size_t i=0; i<sizeof(windows)/sizeof(windows[0]); ++i)
+        {
+            call_taps(windows[i], in, out, tmp);
+            call_window(windows[i], in, out);
+            PTEST_SEPARATOR;
+        }
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Analyzer.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/SpectrumTap.h>
+#include <private/rmod/StereoFFTCrossover.h>
+
+#include <stdlib.h>
+
+#define SAMPLES         0x2000
+#define BLOCK_SIZE      0x200
+#define SAMPLE_RATE     48000
+#define BANDS           4
+#define POINTS          640
+#define ANALYZER_RANK   13
+#define ANALYZER_RATE   20.0f
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", spectrum_tap, 5, 100)
+
+    static void band_handler(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+    {
+        float *dst      = static_cast<float *>(subject);
+        lsp::dsp::add2(&dst[sample], data, count);
+    }
+
+    static void spectrum_handler(void *object, void *subject, const float *fft, size_t rank)
+    {
+        lsp::rmod::SpectrumTap *tap = static_cast<lsp::rmod::SpectrumTap *>(subject);
+        tap->process(fft, rank);
+    }
+
+    void configure(lsp::rmod::StereoFFTCrossover *xover, size_t rank, float *l, float *r)
+    {
+        static const float freqs[] = { 0.0f, 200.0f, 1000.0f, 5000.0f, SAMPLE_RATE * 0.5f };
+
+        xover->set_sample_rate(SAMPLE_RATE);
+        xover->init(rank, BANDS);
+        for (size_t i=0; i<BANDS; ++i)
+        {
+            xover->enable_band(i, true);
+            xover->set_hpf(i, freqs[i], -48.0f, i > 0);
+            xover->set_lpf(i, freqs[i+1], -48.0f, i < (BANDS - 1));
+            xover->set_handler(0, i, band_handler, NULL, l);
+            xover->set_handler(1, i, band_handler, NULL, r);
+        }
+        xover->update_settings();
+    }
+
+    void call_xover(const char *label, size_t rank, const float *in, float *out, lsp::rmod::SpectrumTap *tap)
+    {
+        lsp::rmod::StereoFFTCrossover xover;
+        configure(&xover, rank, out, &out[BLOCK_SIZE]);
+        if (tap != NULL)
+            xover.set_spectrum_handler(spectrum_handler, NULL, tap);
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s rank=%d", label, int(rank));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<SAMPLES; i += BLOCK_SIZE)
+            {
+                lsp::dsp::fill_zero(out, BLOCK_SIZE * 2);
+                xover.process(&in[i], &in[SAMPLES + i], BLOCK_SIZE);
+            }
+        );
+    }
+
+    void call_xover_analyzer(const char *label, size_t rank, float *in, float *out)
+    {
+        lsp::rmod::StereoFFTCrossover xover;
+        configure(&xover, rank, out, &out[BLOCK_SIZE]);
+
+        lsp::dspu::Analyzer an;
+        an.init(2, ANALYZER_RANK, SAMPLE_RATE, ANALYZER_RATE);
+        an.set_rank(ANALYZER_RANK);
+        an.set_rate(ANALYZER_RATE);
+        an.set_sample_rate(SAMPLE_RATE);
+        an.set_window(lsp::dspu::windows::HANN);
+        an.set_envelope(lsp::dspu::envelope::WHITE_NOISE);
+        an.enable_channel(0, true);
+        an.enable_channel(1, true);
+        an.set_activity(true);
+        an.reconfigure();
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s rank=%d", label, int(rank));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<SAMPLES; i += BLOCK_SIZE)
+            {
+                float *an_in[2]     = { &in[i], &in[SAMPLES + i] };
+                lsp::dsp::fill_zero(out, BLOCK_SIZE * 2);
+                xover.process(an_in[0], an_in[1], BLOCK_SIZE);
+                an.process(an_in, BLOCK_SIZE);
+            }
+        );
+
+        an.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *in           = lsp::alloc_aligned<float>(data, SAMPLES * 2 + BLOCK_SIZE * 2 + POINTS, 64);
+        float *out          = &in[SAMPLES * 2];
+        float *freqs        = &out[BLOCK_SIZE * 2];
+
+        for (size_t i=0; i<SAMPLES * 2; ++i)
+            in[i]               = float(rand()) / RAND_MAX - 0.5f;
+        for (size_t i=0; i<POINTS; ++i)
+            freqs[i]            = 10.0f * expf(i * logf(24000.0f / 10.0f) / (POINTS - 1));
+
+        lsp::rmod::SpectrumTap tap;
+        tap.init(freqs, POINTS);
+        tap.set_sample_rate(SAMPLE_RATE);
+        tap.set_reactivity(200.0f);
+        tap.set_active(true);
+
+        for (size_t rank=10; rank<=13; ++rank)
+        {
+            call_xover("xover", rank, in, out, NULL);
+            call_xover("xover + tap", rank, in, out, &tap);
+            call_xover_analyzer("xover + analyzer", rank, in, out);
+            PTEST_SEPARATOR;
+        }
+
+        tap.destroy();
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/rmod/StereoFFTCrossover.h>
+
+#include <stdlib.h>
+
+#define SAMPLES         0x2000
+#define BLOCK_SIZE      0x200
+#define SAMPLE_RATE     48000
+#define BANDS           4
+
+PTEST_BEGIN("mb_ringmod_sc.rmod", stereo_fft_crossover, 5, 100)
+
+    static void band_handler(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+    {
+        float *dst      = static_cast<float *>(subject);
+        lsp::dsp::add2(&dst[sample], data, count);
+    }
+
+    void configure(lsp::rmod::StereoFFTCrossover *xover, size_t rank, float *l, float *r)
+    {
+        static const float freqs[] = { 0.0f, 200.0f, 1000.0f, 5000.0f, SAMPLE_RATE * 0.5f };
+
+        xover->set_sample_rate(SAMPLE_RATE);
+        xover->init(rank, BANDS);
+        for (size_t i=0; i<BANDS; ++i)
+        {
+            xover->enable_band(i, true);
+            xover->set_hpf(i, freqs[i], -48.0f, i > 0);
+            xover->set_lpf(i, freqs[i+1], -48.0f, i < (BANDS - 1));
+            xover->set_handler(0, i, band_handler, NULL, l);
+            xover->set_handler(1, i, band_handler, NULL, r);
+        }
+        xover->update_settings();
+    }
+
+    void call(const char *label, size_t rank, const float *in, float *out, bool stereo)
+    {
+        lsp::rmod::StereoFFTCrossover xover;
+        configure(&xover, rank, out, &out[BLOCK_SIZE]);
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s rank=%d", label, int(rank));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<SAMPLES; i += BLOCK_SIZE)
+            {
+                lsp::dsp::fill_zero(out, BLOCK_SIZE * 2);
+                if (stereo)
+                    xover.process(&in[i], &in[SAMPLES + i], BLOCK_SIZE);
+                else
+                {
+                    // Emulate two independent crossovers, one for each channel
+                    xover.process(&in[i], NULL, BLOCK_SIZE);
+                    xover.process(&in[SAMPLES + i], NULL, BLOCK_SIZE);
+                }
+            }
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *in           = lsp::alloc_aligned<float>(data, SAMPLES * 2 + BLOCK_SIZE * 2, 64);
+        float *out          = &in[SAMPLES * 2];
+
+        for (size_t i=0; i<SAMPLES * 2; ++i)
+            in[i]               = float(rand()) / RAND_MAX - 0.5f;
+
+        for (size_t rank=10; rank<=13; ++rank)
+        {
+            call("mono x2", rank, in, out, false);
+            call("stereo", rank, in, out, true);
+            PTEST_SEPARATOR;
+        }
+
+        lsp::free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/plugins/mb_ringmod_sc.h>
+#include <private/test/harness.h>
+
+#define BLOCK_SIZE          512
+#define SAMPLE_RATE         48000
+
+namespace
+{
+    using namespace lsp;
+
+    typedef struct param_t
+    {
+        const char             *id;                 // Port identifier
+        float                   values[2];          // Values to alternate between
+    } param_t;
+}
+
+PTEST_BEGIN("mb_ringmod_sc", update_settings, 5, 1000)
+
+    void call(const meta::plugin_t *meta, size_t mode, const param_t *param)
+    {
+        char id[32];
+        test::PluginHarness h;
+        if (!h.init(new plugins::mb_ringmod_sc(meta), SAMPLE_RATE, BLOCK_SIZE))
+        {
+            PTEST_FAIL_MSG("Failed to initialize plugin %s", meta->uid);
+            return;
+        }
+
+        // Enable all bands
+        h.set("mode", mode);
+        for (size_t i=1; i<meta::mb_ringmod_sc::BANDS_MAX; ++i)
+        {
+            snprintf(id, sizeof(id), "se_%d", int(i));
+            h.set(id, 1.0f);
+        }
+        h.process(BLOCK_SIZE);
+
+        char label[128];
+        snprintf(label, sizeof(label), "%s %s automate %s",
+            meta->uid,
+            (mode == 0) ? "iir" : (mode == 1) ? "spm" : "ll",
+            (param != NULL) ? param->id : "nothing");
+        printf("Testing %s...\n", label);
+
+        // Emulate the automation of one parameter: each call changes the value of the port
+        plug::Module *plugin    = h.module();
+        plug::IPort *port       = (param != NULL) ? h.port(param->id) : NULL;
+        size_t step             = 0;
+        PTEST_LOOP(label,
+            if (port != NULL)
+                port->set_value(param->values[(step++) & 1]);
+            plugin->update_settings();
+        );
+    }
+
+    PTEST_MAIN
+    {
+        static const meta::plugin_t *plugins[] =
+        {
+            &meta::mb_ringmod_sc_mono,
+            &meta::mb_ringmod_sc_stereo
+        };
+        static const param_t params[] =
+        {
+            { "sf_4",   { 600.0f, 650.0f }      },  // Split frequency
+            { "rt_4",   { 50.0f, 60.0f }        },  // Band release time
+            { "am_4",   { -6.0f, -12.0f }       },  // Band amount
+            { "bg_4",   { 1.0f, 0.5f }          },  // Band gain
+            { "g_in",   { 1.0f, 0.5f }          },  // Input gain
+        };
+
+        for (size_t i=0; i<sizeof(plugins)/sizeof(plugins[0]); ++i)
+        {
+            for (size_t mode=0; mode < 3; ++mode)
+            {
+                call(plugins[i], mode, NULL);
+                for (size_t j=0; j<sizeof(params)/sizeof(params[0]); ++j)
+                    call(plugins[i], mode, &params[j]);
+                PTEST_SEPARATOR;
+            }
+            PTEST_SEPARATOR2;
+        }
+    }
+
+PTEST_END
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/plugins/mb_ringmod_sc.h>
+#include <private/test/harness.h>
+#include <private/test/render.h>
+
+#include <math.h>
+
+/*
+ * Renders the deterministic input files from the 'render' resource directory with the
+ * stored plugin configurations and compares the output with the reference files.
+ *
+ * The inputs are generated by 'generate.py' from the resource directory. The reference
+ * file for the case is rendered by the known-good build, if it is missing, the output
+ * is saved to the temporary directory and the test fails. The same output can be produced
+ * by the 'render' manual test:
+ *   render -i <in> -s <sc> -c <case>.cfg -b 512 -o <case>.ref.wav
+ */
+
+#define BLOCK_SIZE          512
+#define PATH_SIZE           0x400
+
+UTEST_BEGIN("mb_ringmod_sc", render)
+
+    typedef struct case_t
+    {
+        const char     *name;               // Name of the case, also the name of configuration file
+        const char     *in;                 // Input file
+        const char     *sc;                 // Sidechain file
+        float           tolerance;          // Maximum allowed absolute difference
+    } case_t;
+
+    bool load_file(dspu::Sample *s, const char *name)
+    {
+        char path[PATH_SIZE];
+        snprintf(path, sizeof(path), "%s/render/%s", resources(), name);
+        if (s->load(path) == STATUS_OK)
+            return true;
+
+        fprintf(stderr, "Failed to load file %s\n", path);
+        return false;
+    }
+
+    void render_case(const case_t *c)
+    {
+        printf("Testing render case '%s'...\n", c->name);
+
+        dspu::Sample in, sc, out, ref;
+        UTEST_ASSERT(load_file(&in, c->in));
+        UTEST_ASSERT(load_file(&sc, c->sc));
+        UTEST_ASSERT(sc.sample_rate() == in.sample_rate());
+
+        // Configure and render
+        const meta::plugin_t *meta  = (in.channels() > 1) ? &meta::mb_ringmod_sc_stereo : &meta::mb_ringmod_sc_mono;
+        test::PluginHarness h;
+        UTEST_ASSERT(h.init(new plugins::mb_ringmod_sc(meta), in.sample_rate(), BLOCK_SIZE));
+
+        char path[PATH_SIZE];
+        snprintf(path, sizeof(path), "%s/render/%s.cfg", resources(), c->name);
+        UTEST_ASSERT_MSG(test::load_config(h, path), "Failed to load configuration file %s", path);
+
+        size_t latency = 0;
+        UTEST_ASSERT(test::render(&out, &latency, NULL, h, &in, &sc, NULL));
+        printf("  latency: %d samples\n", int(latency));
+
+        // Save the output for the missing reference
+        snprintf(path, sizeof(path), "%s/render/%s.ref.wav", resources(), c->name);
+        if (ref.load(path) != STATUS_OK)
+        {
+            char dst[PATH_SIZE];
+            snprintf(dst, sizeof(dst), "%s/%s.ref.wav", tempdir(), c->name);
+            const ssize_t written = out.save(dst);
+            UTEST_FAIL_MSG("Missing reference file %s, the output has been saved to %s (status %d)",
+                path, dst, int(written));
+        }
+
+        UTEST_ASSERT_MSG(ref.channels() == out.channels(), "Reference has %d channels, expected %d",
+            int(ref.channels()), int(out.channels()));
+        UTEST_ASSERT_MSG(ref.length() == out.length(), "Reference has %d samples, expected %d",
+            int(ref.length()), int(out.length()));
+
+        // Compare the output with the reference
+        for (size_t i=0; i<out.channels(); ++i)
+        {
+            const float *a      = out.channel(i);
+            const float *b      = ref.channel(i);
+            for (size_t j=0; j<out.length(); ++j)
+            {
+                const float diff    = fabsf(a[j] - b[j]);
+                if (diff > c->tolerance)
+                    UTEST_FAIL_MSG("Case '%s': channel %d differs from reference at sample %d: %g vs %g",
+                        c->name, int(i), int(j), a[j], b[j]);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        static const case_t cases[] =
+        {
+            { "iir_mono",       "in_mono.wav",      "sc_mono.wav",      1e-5f   },
+            { "iir_stereo",     "in_stereo.wav",    "sc_stereo.wav",    1e-5f   },
+            { "fft_stereo",     "in_stereo.wav",    "sc_stereo.wav",    1e-5f   },
+            { "fir_mono",       "in_mono.wav",      "sc_mono.wav",      1e-5f   },
+        };
+
+        for (size_t i=0; i<sizeof(cases)/sizeof(cases[0]); ++i)
+            render_case(&cases[i]);
+    }
+
+UTEST_END
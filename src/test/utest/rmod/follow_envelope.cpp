@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/dsp.h>
+
+#define LANES_MAX       16
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void follow_envelope(float * const *env, const follower_t *f, float gain, size_t lanes, size_t samples);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* follow_envelope_t)(float * const *env, const lsp::rmod::follower_t *f, float gain, size_t lanes, size_t samples);
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", follow_envelope)
+
+    void init_state(float *peak, uint32_t *hold, float *tau, uint32_t *hold_max, size_t lanes)
+    {
+        // Lanes start in different states: holding, releasing and idle
+        for (size_t i=0; i<lanes; ++i)
+        {
+            peak[i]         = 0.1f * (i % 3);
+            hold[i]         = (i % 4) * 2;
+            tau[i]          = 0.05f * (i + 1);
+            hold_max[i]     = (i % 5) * 3;
+        }
+    }
+
+    void call(const char *label, size_t align, follow_envelope_t func)
+    {
+        if (!func)
+            return;
+
+        float peak1[LANES_MAX], peak2[LANES_MAX], tau[LANES_MAX];
+        uint32_t hold1[LANES_MAX], hold2[LANES_MAX], hold_max[LANES_MAX];
+        float *env1[LANES_MAX], *env2[LANES_MAX];
+
+        UTEST_FOREACH(lanes, 1, 2, 3, 4, 5, 7, 8, 9, 12, 15, 16)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33, 65, 999)
+            {
+                for (size_t mask=0; mask <= 0x01; ++mask)
+                {
+                    printf("Testing %s on %d lanes of %d numbers, mask=0x%x...\n", label, int(lanes), int(count), int(mask));
+
+                    // Lanes are laid out one after another, so each of them has different alignment
+                    FloatBuffer src1(count * lanes, align, mask & 0x01);
+                    src1.randomize_sign();
+                    FloatBuffer src2(src1);
+
+                    for (size_t i=0; i<lanes; ++i)
+                    {
+                        env1[i]         = &src1.data()[i * count];
+                        env2[i]         = &src2.data()[i * count];
+                    }
+                    init_state(peak1, hold1, tau, hold_max, lanes);
+                    init_state(peak2, hold2, tau, hold_max, lanes);
+
+                    const lsp::rmod::follower_t f1 = { peak1, hold1, tau, hold_max };
+                    const lsp::rmod::follower_t f2 = { peak2, hold2, tau, hold_max };
+
+                    lsp::rmod::generic::follow_envelope(env1, &f1, 2.0f, lanes, count);
+                    func(env2, &f2, 2.0f, lanes, count);
+
+                    UTEST_ASSERT_MSG(src1.valid(), "Buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(src2.valid(), "Buffer 2 corrupted");
+
+                    // Compare buffers and the state of followers
+                    if (!src1.equals_relative(src2, 1e-5))
+                    {
+                        src1.dump("src1");
+                        src2.dump("src2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs", label);
+                    }
+                    for (size_t i=0; i<lanes; ++i)
+                    {
+                        UTEST_ASSERT_MSG(float_equals_relative(peak1[i], peak2[i], 1e-5),
+                            "Peak of lane %d for test '%s' differs: %g vs %g", int(i), label, peak1[i], peak2[i]);
+                        UTEST_ASSERT_MSG(hold1[i] == hold2[i],
+                            "Hold counter of lane %d for test '%s' differs: %d vs %d", int(i), label, int(hold1[i]), int(hold2[i]));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+    #ifdef ARCH_X86
+        if (lsp::rmod::sse2::supported())
+            call("sse2", 16, lsp::rmod::sse2::follow_envelope);
+        if (lsp::rmod::avx2::supported())
+            call("avx2", 32, lsp::rmod::avx2::follow_envelope);
+    #endif /* ARCH_X86 */
+    #ifdef __ARM_NEON
+        call("neon", 16, lsp::rmod::neon::follow_envelope);
+    #endif /* __ARM_NEON */
+    }
+
+UTEST_END
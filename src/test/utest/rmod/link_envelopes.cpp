@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/dsp.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void link_envelopes(float *l, float *r, float link, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void link_envelopes(float *l, float *r, float link, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void link_envelopes(float *l, float *r, float link, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* link_envelopes_t)(float *l, float *r, float link, size_t count);
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", link_envelopes)
+
+    void call(const char *label, size_t align, link_envelopes_t func)
+    {
+        if (!func)
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 999)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer l1(count, align, mask & 0x01);
+                FloatBuffer r1(count, align, mask & 0x02);
+                l1.randomize_positive();
+                r1.randomize_positive();
+                FloatBuffer l2(l1);
+                FloatBuffer r2(r1);
+
+                lsp::rmod::generic::link_envelopes(l1, r1, 0.7f, count);
+                func(l2, r2, 0.7f, count);
+
+                UTEST_ASSERT_MSG(l1.valid(), "Buffer l1 corrupted");
+                UTEST_ASSERT_MSG(r1.valid(), "Buffer r1 corrupted");
+                UTEST_ASSERT_MSG(l2.valid(), "Buffer l2 corrupted");
+                UTEST_ASSERT_MSG(r2.valid(), "Buffer r2 corrupted");
+
+                // Compare buffers
+                if ((!l1.equals_relative(l2, 1e-5)) || (!r1.equals_relative(r2, 1e-5)))
+                {
+                    l1.dump("l1");
+                    l2.dump("l2");
+                    r1.dump("r1");
+                    r2.dump("r2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs", label);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+    #ifdef ARCH_X86
+        if (lsp::rmod::sse2::supported())
+            call("sse2", 16, lsp::rmod::sse2::link_envelopes);
+        if (lsp::rmod::avx2::supported())
+            call("avx2", 32, lsp::rmod::avx2::link_envelopes);
+    #endif /* ARCH_X86 */
+    #ifdef __ARM_NEON
+        call("neon", 16, lsp::rmod::neon::link_envelopes);
+    #endif /* __ARM_NEON */
+    }
+
+UTEST_END
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/dsp.h>
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            float mix_band(float *in, float *out, const float *src, const float *env, const band_mix_t *m, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef float (* mix_band_t)(float *in, float *out, const float *src, const float *env, const lsp::rmod::band_mix_t *m, size_t count);
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", mix_band)
+
+    void call(const char *label, size_t align, mix_band_t func)
+    {
+        if (!func)
+            return;
+
+        // The negative envelope term makes the gain clip at zero for the loud parts of the envelope
+        const lsp::rmod::band_mix_t m = { 1.0f, -1.5f, 0.5f, 0.25f, 0.75f };
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 999)
+        {
+            for (size_t mask=0; mask <= 0x0f; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer env(count, align, mask & 0x02);
+                FloatBuffer in1(count, align, mask & 0x04);
+                FloatBuffer out1(count, align, mask & 0x08);
+                src.randomize_sign();
+                env.randomize_positive();
+                in1.randomize_sign();
+                out1.randomize_sign();
+                FloatBuffer in2(in1);
+                FloatBuffer out2(out1);
+
+                const float min1    = lsp::rmod::generic::mix_band(in1, out1, src, env, &m, count);
+                const float min2    = func(in2, out2, src, env, &m, count);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(env.valid(), "Envelope buffer corrupted");
+                UTEST_ASSERT_MSG(in1.valid(), "Input buffer 1 corrupted");
+                UTEST_ASSERT_MSG(in2.valid(), "Input buffer 2 corrupted");
+                UTEST_ASSERT_MSG(out1.valid(), "Output buffer 1 corrupted");
+                UTEST_ASSERT_MSG(out2.valid(), "Output buffer 2 corrupted");
+
+                // Compare buffers and the minimum gain
+                if ((!in1.equals_relative(in2, 1e-5)) || (!out1.equals_relative(out2, 1e-5)))
+                {
+                    src.dump("src");
+                    env.dump("env");
+                    in1.dump("in1");
+                    in2.dump("in2");
+                    out1.dump("out1");
+                    out2.dump("out2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs", label);
+                }
+                UTEST_ASSERT_MSG(float_equals_relative(min1, min2, 1e-5),
+                    "Minimum gain of functions for test '%s' differs: %g vs %g", label, min1, min2);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+    #ifdef ARCH_X86
+        if (lsp::rmod::sse2::supported())
+            call("sse2", 16, lsp::rmod::sse2::mix_band);
+        if (lsp::rmod::avx2::supported())
+            call("avx2", 32, lsp::rmod::avx2::mix_band);
+    #endif /* ARCH_X86 */
+    #ifdef __ARM_NEON
+        call("neon", 16, lsp::rmod::neon::mix_band);
+    #endif /* __ARM_NEON */
+    }
+
+UTEST_END
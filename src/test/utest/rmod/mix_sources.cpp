@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/dsp.h>
+
+#define SOURCES_MAX     8
+
+namespace lsp
+{
+    namespace rmod
+    {
+    #ifdef ARCH_X86
+        namespace sse2
+        {
+            bool supported();
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace sse2 */
+
+        namespace avx2
+        {
+            bool supported();
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace avx2 */
+    #endif /* ARCH_X86 */
+
+    #ifdef __ARM_NEON
+        namespace neon
+        {
+            void mix_sources(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+        } /* namespace neon */
+    #endif /* __ARM_NEON */
+    } /* namespace rmod */
+} /* namespace lsp */
+
+typedef void (* mix_sources_t)(float *dst, const float * const *src, const float *k, size_t n, size_t count);
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", mix_sources)
+
+    void call(const char *label, size_t align, mix_sources_t func)
+    {
+        if (!func)
+            return;
+
+        static const float k[SOURCES_MAX] = { 0.5f, -0.25f, 1.0f, 0.75f, -1.5f, 0.125f, 2.0f, -0.5f };
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 999)
+        {
+            for (size_t n=1; n <= SOURCES_MAX; ++n)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s on %d input buffers of %d numbers, mask=0x%x...\n", label, int(n), int(count), int(mask));
+
+                    // Sources are laid out one after another, so each of them has different alignment
+                    FloatBuffer src(count * n, align, mask & 0x01);
+                    FloatBuffer dst1(count, align, mask & 0x02);
+                    src.randomize_sign();
+                    dst1.randomize_sign();
+                    FloatBuffer dst2(dst1);
+
+                    const float *vsrc[SOURCES_MAX];
+                    for (size_t i=0; i<n; ++i)
+                        vsrc[i]         = &src.data()[i * count];
+
+                    lsp::rmod::generic::mix_sources(dst1, vsrc, k, n, count);
+                    func(dst2, vsrc, k, n, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, 1e-5))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs", label);
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+    #ifdef ARCH_X86
+        if (lsp::rmod::sse2::supported())
+            call("sse2", 16, lsp::rmod::sse2::mix_sources);
+        if (lsp::rmod::avx2::supported())
+            call("avx2", 32, lsp::rmod::avx2::mix_sources);
+    #endif /* ARCH_X86 */
+    #ifdef __ARM_NEON
+        call("neon", 16, lsp::rmod::neon::mix_sources);
+    #endif /* __ARM_NEON */
+    }
+
+UTEST_END
@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/PartitionedCrossover.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#define SAMPLE_RATE     48000
+#define MAX_RANK        10
+#define BANDS           3
+#define TOLERANCE       1e-4f
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", partitioned_crossover)
+
+    typedef struct context_t
+    {
+        FloatBuffer    *vOut[2];            // Sum of bands for each channel
+        FloatBuffer    *vBand[2];           // Output of the first band for each channel
+        size_t          nOffset;            // Offset of the processed block in the output
+        size_t          nSamples;           // Number of samples in the processed block
+        size_t          nErrors;            // Number of invalid calls of the handler
+    } context_t;
+
+    static void process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+    {
+        context_t *ctx      = static_cast<context_t *>(object);
+        const size_t channel= reinterpret_cast<size_t>(subject);
+
+        // The third band is disabled and should never be reported
+        if ((band >= BANDS - 1) || (sample + count > ctx->nSamples))
+        {
+            ++ctx->nErrors;
+            return;
+        }
+
+        float *dst          = &ctx->vOut[channel]->data()[ctx->nOffset + sample];
+        for (size_t i=0; i<count; ++i)
+            dst[i]             += data[i];
+
+        if ((band != 0) || (ctx->vBand[channel] == NULL))
+            return;
+        dst                 = &ctx->vBand[channel]->data()[ctx->nOffset + sample];
+        for (size_t i=0; i<count; ++i)
+            dst[i]             += data[i];
+    }
+
+    void setup(lsp::rmod::PartitionedCrossover &xc, context_t *ctx, bool split)
+    {
+        xc.set_sample_rate(SAMPLE_RATE);
+        for (size_t i=0; i<BANDS; ++i)
+        {
+            xc.set_handler(0, i, process_band, ctx, reinterpret_cast<void *>(size_t(0)));
+            xc.set_handler(1, i, process_band, ctx, reinterpret_cast<void *>(size_t(1)));
+        }
+
+        // Either a single band passing the whole spectrum or two complementary bands,
+        // the last band is configured but stays disabled
+        xc.enable_band(0, true);
+        xc.enable_band(1, split);
+        xc.enable_band(2, false);
+        xc.set_lpf(0, 1000.0f, -24.0f, split);
+        xc.set_hpf(1, 1000.0f, -24.0f, true);
+        xc.set_lpf(1, 8000.0f, -24.0f, false);
+        xc.set_hpf(2, 8000.0f, -24.0f, true);
+        xc.update_settings();
+    }
+
+    // Unit impulse of the specified amplitude followed by silence
+    void make_impulse(FloatBuffer &buf, size_t offset, float amp, size_t count)
+    {
+        float *dst          = &buf.data()[offset];
+        for (size_t i=0; i<count; ++i)
+            dst[i]              = 0.0f;
+        dst[0]              = amp;
+    }
+
+    // Process the input split into blocks of random size
+    void process(lsp::rmod::PartitionedCrossover &xc, context_t *ctx,
+        const float *left, const float *right, size_t offset, size_t count)
+    {
+        for (size_t done=0; done < count; )
+        {
+            const size_t block  = size_t(rand()) % 300 + 1;
+            const size_t to_do  = lsp_min(block, count - done);
+            ctx->nOffset        = offset + done;
+            ctx->nSamples       = to_do;
+            xc.process(&left[offset + done], (right != NULL) ? &right[offset + done] : NULL, to_do);
+            done               += to_do;
+        }
+    }
+
+    // The sum of bands should be the input impulse delayed by the latency of the crossover
+    void check_impulse(const char *label, FloatBuffer &out, size_t offset, size_t latency, float amp, size_t count)
+    {
+        const float *dst    = &out.data()[offset];
+        for (size_t i=0; i<count; ++i)
+        {
+            const float expected    = (i == latency) ? amp : 0.0f;
+            if (fabsf(dst[i] - expected) > TOLERANCE)
+            {
+                out.dump("out");
+                UTEST_FAIL_MSG("Test '%s' latency=%d: sample %d of impulse response is %g, expected %g",
+                    label, int(latency), int(i), dst[i], expected);
+            }
+        }
+    }
+
+    // The impulse response of the band is linear-phase: it is symmetric around the latency
+    // and does not exceed the filter length, the partitions should be convolved in proper order
+    void check_band(const char *label, FloatBuffer &out, size_t latency, size_t half, size_t count)
+    {
+        const float *dst    = out.data();
+        for (size_t i=0; i<count; ++i)
+        {
+            const bool inside       = (i + half > latency) && (i < latency + half);
+            if ((!inside) && (fabsf(dst[i]) > TOLERANCE))
+            {
+                out.dump("band");
+                UTEST_FAIL_MSG("Test '%s' latency=%d: sample %d of band impulse response is %g, expected 0",
+                    label, int(latency), int(i), dst[i]);
+            }
+        }
+
+        for (size_t i=1; i<half; ++i)
+        {
+            const float a   = dst[latency - i];
+            const float b   = dst[latency + i];
+            if (fabsf(a - b) > TOLERANCE)
+            {
+                out.dump("band");
+                UTEST_FAIL_MSG("Test '%s' latency=%d: band impulse response is not symmetric at offset %d: %g vs %g",
+                    label, int(latency), int(i), a, b);
+            }
+        }
+    }
+
+    void test_impulse(size_t rank, size_t part_rank, size_t channels, bool split)
+    {
+        char label[80];
+        snprintf(label, sizeof(label), "rank=%d, part_rank=%d, channels=%d, bands=%d",
+            int(rank), int(part_rank), int(channels), (split) ? 2 : 1);
+        printf("Testing impulse response for %s...\n", label);
+
+        const size_t length = (size_t(1) << rank) * 3;
+        FloatBuffer left(length);
+        FloatBuffer right(length);
+        FloatBuffer out_l(length);
+        FloatBuffer out_r(length);
+        FloatBuffer band_l(length);
+        FloatBuffer band_r(length);
+        left.fill_zero();
+        right.fill_zero();
+        out_l.fill_zero();
+        out_r.fill_zero();
+        band_l.fill_zero();
+        band_r.fill_zero();
+        left.data()[0]      = 1.0f;
+        right.data()[0]     = -0.5f;
+
+        context_t ctx;
+        ctx.vOut[0]         = &out_l;
+        ctx.vOut[1]         = &out_r;
+        ctx.vBand[0]        = &band_l;
+        ctx.vBand[1]        = &band_r;
+        ctx.nErrors         = 0;
+
+        lsp::rmod::PartitionedCrossover xc;
+        UTEST_ASSERT(xc.init(rank, part_rank, BANDS));
+        setup(xc, &ctx, split);
+
+        const size_t latency= xc.latency();
+        UTEST_ASSERT(latency == (size_t(1) << part_rank) + (size_t(1) << (rank - 1)));
+
+        process(xc, &ctx, left.data(), (channels > 1) ? right.data() : NULL, 0, length);
+
+        UTEST_ASSERT_MSG(ctx.nErrors == 0, "Test '%s': %d invalid handler calls", label, int(ctx.nErrors));
+        UTEST_ASSERT_MSG(left.valid(), "Left input buffer corrupted");
+        UTEST_ASSERT_MSG(right.valid(), "Right input buffer corrupted");
+        UTEST_ASSERT_MSG(out_l.valid(), "Left output buffer corrupted");
+        UTEST_ASSERT_MSG(out_r.valid(), "Right output buffer corrupted");
+        UTEST_ASSERT_MSG(band_l.valid(), "Left band buffer corrupted");
+        UTEST_ASSERT_MSG(band_r.valid(), "Right band buffer corrupted");
+
+        const size_t half   = size_t(1) << (rank - 1);
+        check_impulse(label, out_l, 0, latency, 1.0f, length);
+        check_band(label, band_l, latency, half, length);
+        if (channels > 1)
+        {
+            check_impulse(label, out_r, 0, latency, -0.5f, length);
+            check_band(label, band_r, latency, half, length);
+        }
+        else
+        {
+            check_impulse(label, out_r, 0, length, 0.0f, length);
+            check_impulse(label, band_r, 0, length, 0.0f, length);
+        }
+
+        xc.destroy();
+    }
+
+    void test_changes(size_t channels)
+    {
+        printf("Testing partition and rank changes for channels=%d...\n", int(channels));
+
+        const size_t segment    = (size_t(1) << MAX_RANK) * 3;
+        const size_t segments   = 24;
+        const size_t length     = segment * segments;
+        FloatBuffer left(length);
+        FloatBuffer right(length);
+        FloatBuffer out_l(length);
+        FloatBuffer out_r(length);
+        left.randomize_sign();
+        right.randomize_sign();
+        out_l.fill_zero();
+        out_r.fill_zero();
+
+        context_t ctx;
+        ctx.vOut[0]         = &out_l;
+        ctx.vOut[1]         = &out_r;
+        ctx.vBand[0]        = NULL;
+        ctx.vBand[1]        = NULL;
+        ctx.nErrors         = 0;
+
+        lsp::rmod::PartitionedCrossover xc;
+        UTEST_ASSERT(xc.init(MAX_RANK, MAX_RANK - 1, BANDS));
+        setup(xc, &ctx, true);
+
+        for (size_t i=0; i<segments; ++i)
+        {
+            const size_t offset     = i * segment;
+
+            // Process the noise, change the partition size or the filter length in the middle of the stream
+            const size_t noise      = segment / 2;
+            const size_t rank       = xc.rank();
+            const size_t part_rank  = xc.partition_rank();
+            process(xc, &ctx, left.data(), (channels > 1) ? right.data() : NULL, offset, noise);
+            if (i & 1)
+                xc.set_partition(size_t(rand()) % (xc.rank() + 2));
+            else
+                xc.set_rank(size_t(rand()) % (MAX_RANK + 2), size_t(rand()) % (MAX_RANK + 1));
+
+            UTEST_ASSERT(xc.rank() >= 1);
+            UTEST_ASSERT(xc.rank() <= MAX_RANK);
+            UTEST_ASSERT(xc.partition_rank() < xc.rank());
+
+            // The state is cleared after the change, so the response to the impulse
+            // contains no tail of the noise and can be checked if it fits into the segment
+            const bool changed      = (xc.rank() != rank) || (xc.partition_rank() != part_rank);
+            const size_t latency    = xc.latency();
+            const size_t rest       = segment - noise;
+            make_impulse(left, offset + noise, 1.0f, rest);
+            make_impulse(right, offset + noise, -0.5f, rest);
+            process(xc, &ctx, left.data(), (channels > 1) ? right.data() : NULL, offset + noise, rest);
+
+            UTEST_ASSERT_MSG(ctx.nErrors == 0, "Segment %d: %d invalid handler calls", int(i), int(ctx.nErrors));
+            if (!changed)
+                continue;
+
+            char label[80];
+            snprintf(label, sizeof(label), "segment %d, rank=%d, part_rank=%d",
+                int(i), int(xc.rank()), int(xc.partition_rank()));
+            check_impulse(label, out_l, offset + noise, latency, 1.0f, rest);
+            if (channels > 1)
+                check_impulse(label, out_r, offset + noise, latency, -0.5f, rest);
+        }
+
+        UTEST_ASSERT_MSG(left.valid(), "Left input buffer corrupted");
+        UTEST_ASSERT_MSG(right.valid(), "Right input buffer corrupted");
+        UTEST_ASSERT_MSG(out_l.valid(), "Left output buffer corrupted");
+        UTEST_ASSERT_MSG(out_r.valid(), "Right output buffer corrupted");
+
+        xc.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        srand(0x5eed);
+
+        UTEST_FOREACH(channels, 1, 2)
+        {
+            for (size_t rank=1; rank <= MAX_RANK; ++rank)
+            {
+                for (size_t part_rank=0; part_rank < rank; ++part_rank)
+                {
+                    test_impulse(rank, part_rank, channels, false);
+                    test_impulse(rank, part_rank, channels, true);
+                }
+            }
+
+            test_changes(channels);
+        }
+    }
+
+UTEST_END
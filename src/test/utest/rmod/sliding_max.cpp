@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/SlidingMax.h>
+
+#include <stdlib.h>
+
+#define CAPACITY        64
+#define SAMPLES         0x1000
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", sliding_max)
+
+    // Naive O(W) maximum over the window, samples preceding the stream are zero
+    void naive_max(float *dst, const float *src, size_t window, size_t count)
+    {
+        window          = lsp_max(window, size_t(1));
+        for (size_t i=0; i<count; ++i)
+        {
+            const size_t first  = (i >= window) ? i - window + 1 : 0;
+            float max           = 0.0f;
+            for (size_t j=first; j<=i; ++j)
+                max                 = lsp_max(max, src[j]);
+            dst[i]              = max;
+        }
+    }
+
+    // Random length of the block, blocks are shorter and longer than the window
+    // so that they end both inside and past the block of the algorithm
+    size_t block_size(size_t window, size_t left)
+    {
+        const size_t range  = lsp_max(window, size_t(4)) * 3;
+        const size_t count  = size_t(rand()) % range;
+        return lsp_min(count, left);
+    }
+
+    void compare(const char *label, FloatBuffer &src, FloatBuffer &dst, FloatBuffer &ref)
+    {
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        UTEST_ASSERT_MSG(ref.valid(), "Reference buffer corrupted");
+
+        if (!dst.equals_absolute(ref, 1e-6f))
+        {
+            src.dump("src");
+            dst.dump("dst");
+            ref.dump("ref");
+            UTEST_FAIL_MSG("Output for test '%s' differs", label);
+        }
+    }
+
+    void test_window(size_t window, bool in_place)
+    {
+        char label[80];
+        snprintf(label, sizeof(label), "window=%d%s", int(window), (in_place) ? " in-place" : "");
+        printf("Testing %s...\n", label);
+
+        lsp::rmod::SlidingMax sm;
+        UTEST_ASSERT(sm.init(CAPACITY));
+        sm.set_window(window);
+        UTEST_ASSERT(sm.window() == lsp_min(window, size_t(CAPACITY)));
+
+        FloatBuffer src(SAMPLES);
+        FloatBuffer dst(SAMPLES);
+        FloatBuffer ref(SAMPLES);
+        src.randomize_positive();
+        if (in_place)
+            dst.copy(src);
+
+        for (size_t offset=0; offset < SAMPLES; )
+        {
+            const size_t count  = block_size(sm.window(), SAMPLES - offset);
+            const float *in     = (in_place) ? &dst.data()[offset] : &src.data()[offset];
+            sm.process(&dst.data()[offset], in, count);
+            offset             += count;
+        }
+
+        naive_max(ref.data(), src.data(), sm.window(), SAMPLES);
+        compare(label, src, dst, ref);
+
+        sm.destroy();
+    }
+
+    void test_set_window()
+    {
+        static const size_t windows[] = { 1, 2, 3, 5, 16, 17, 63, CAPACITY, CAPACITY + 1, 0 };
+        const size_t n_windows  = sizeof(windows) / sizeof(windows[0]);
+
+        printf("Testing window changes...\n");
+
+        lsp::rmod::SlidingMax sm;
+        UTEST_ASSERT(sm.init(CAPACITY));
+        sm.set_window(16);
+
+        FloatBuffer src(SAMPLES * 4);
+        FloatBuffer dst(SAMPLES * 4);
+        FloatBuffer ref(SAMPLES * 4);
+        src.randomize_positive();
+
+        // The state is cleared on each change of the window, the reference
+        // is computed for each segment of the stream separately
+        size_t start        = 0;
+        for (size_t offset=0; offset < SAMPLES * 4; )
+        {
+            if ((rand() % 4) == 0)
+            {
+                const size_t window     = sm.window();
+                const size_t next       = windows[size_t(rand()) % n_windows];
+                sm.set_window(next);
+                UTEST_ASSERT(sm.window() == lsp_min(next, size_t(CAPACITY)));
+
+                if (sm.window() != window)
+                {
+                    naive_max(&ref.data()[start], &src.data()[start], window, offset - start);
+                    start                   = offset;
+                }
+            }
+
+            const size_t count  = block_size(sm.window(), SAMPLES * 4 - offset);
+            sm.process(&dst.data()[offset], &src.data()[offset], count);
+            offset             += count;
+        }
+
+        naive_max(&ref.data()[start], &src.data()[start], sm.window(), SAMPLES * 4 - start);
+        compare("window changes", src, dst, ref);
+
+        sm.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        srand(0x5eed);
+
+        UTEST_FOREACH(window, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 33, 63, CAPACITY, CAPACITY + 1)
+        {
+            test_window(window, false);
+            test_window(window, true);
+        }
+
+        test_set_window();
+    }
+
+UTEST_END
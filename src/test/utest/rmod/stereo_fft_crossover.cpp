@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2025 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2025 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-mb-ringmod-sc
+ * Created on: 16 окт 2025 г.
+ *
+ * lsp-plugins-mb-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-mb-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-mb-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/util/FFTCrossover.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <private/rmod/StereoFFTCrossover.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#define SAMPLE_RATE     48000
+#define BANDS           4
+#define TOLERANCE       1e-3f
+
+UTEST_BEGIN("mb_ringmod_sc.rmod", stereo_fft_crossover)
+
+    typedef struct context_t
+    {
+        FloatBuffer    *vBand[BANDS][2];    // Output of each band for each channel
+        size_t          nOffset;            // Offset of the processed block in the output
+        size_t          nSamples;           // Number of samples in the processed block
+        size_t          nErrors;            // Number of invalid calls of the handler
+    } context_t;
+
+    static void process_band(void *object, void *subject, size_t band, const float *data, size_t sample, size_t count)
+    {
+        context_t *ctx      = static_cast<context_t *>(object);
+        const size_t channel= reinterpret_cast<size_t>(subject);
+        if ((band >= BANDS) || (sample + count > ctx->nSamples))
+        {
+            ++ctx->nErrors;
+            return;
+        }
+
+        float *dst          = &ctx->vBand[band][channel]->data()[ctx->nOffset + sample];
+        for (size_t i=0; i<count; ++i)
+            dst[i]             += data[i];
+    }
+
+    // The band splits are far enough from each other, so the bands sum to unity
+    template <class T>
+        void setup_bands(T &xc)
+        {
+            static const float splits[] = { 150.0f, 1200.0f, 9000.0f };
+
+            for (size_t i=0; i<BANDS; ++i)
+            {
+                xc.enable_band(i, true);
+                xc.set_hpf(i, (i > 0) ? splits[i - 1] : 10.0f, -48.0f, i > 0);
+                xc.set_lpf(i, (i < BANDS - 1) ? splits[i] : 20000.0f, -48.0f, i < BANDS - 1);
+            }
+            xc.update_settings();
+        }
+
+    void init_context(context_t *ctx, FloatBuffer **bands)
+    {
+        for (size_t i=0; i<BANDS; ++i)
+        {
+            for (size_t j=0; j<2; ++j)
+            {
+                FloatBuffer *buf        = bands[i*2 + j];
+                buf->fill_zero();
+                ctx->vBand[i][j]        = buf;
+            }
+        }
+        ctx->nOffset        = 0;
+        ctx->nSamples       = 0;
+        ctx->nErrors        = 0;
+    }
+
+    void check_buffers(const char *label, context_t *ctx)
+    {
+        UTEST_ASSERT_MSG(ctx->nErrors == 0, "Test '%s': %d invalid handler calls", label, int(ctx->nErrors));
+        for (size_t i=0; i<BANDS; ++i)
+            for (size_t j=0; j<2; ++j)
+                UTEST_ASSERT_MSG(ctx->vBand[i][j]->valid(), "Test '%s': buffer of band %d channel %d corrupted",
+                    label, int(i), int(j));
+    }
+
+    void test_crossover(size_t rank, size_t channels)
+    {
+        char label[80];
+        snprintf(label, sizeof(label), "rank=%d, channels=%d", int(rank), int(channels));
+        printf("Testing %s...\n", label);
+
+        const size_t length     = (size_t(1) << rank) * 8;
+        FloatBuffer left(length);
+        FloatBuffer right(length);
+        left.randomize_sign();
+        right.randomize_sign();
+
+        // Output buffers of the tested crossover and of the reference crossovers
+        FloatBuffer *bufs[BANDS * 4];
+        for (size_t i=0; i<BANDS * 4; ++i)
+            bufs[i]             = new FloatBuffer(length);
+
+        context_t ctx, ref_ctx;
+        init_context(&ctx, &bufs[0]);
+        init_context(&ref_ctx, &bufs[BANDS * 2]);
+
+        // The tested crossover processes both channels at once
+        lsp::rmod::StereoFFTCrossover xc;
+        UTEST_ASSERT(xc.init(rank, BANDS));
+        xc.set_sample_rate(SAMPLE_RATE);
+        for (size_t i=0; i<BANDS; ++i)
+        {
+            xc.set_handler(0, i, process_band, &ctx, reinterpret_cast<void *>(size_t(0)));
+            xc.set_handler(1, i, process_band, &ctx, reinterpret_cast<void *>(size_t(1)));
+        }
+        setup_bands(xc);
+
+        // The reference crossover is used for each channel separately
+        lsp::dspu::FFTCrossover ref[2];
+        for (size_t j=0; j<channels; ++j)
+        {
+            ref[j].init(rank, BANDS);
+            ref[j].set_sample_rate(SAMPLE_RATE);
+            for (size_t i=0; i<BANDS; ++i)
+                ref[j].set_handler(i, process_band, &ref_ctx, reinterpret_cast<void *>(j));
+            setup_bands(ref[j]);
+        }
+
+        // Process the input split into blocks of random size
+        for (size_t offset=0; offset < length; )
+        {
+            const size_t block  = size_t(rand()) % 600 + 1;
+            const size_t to_do  = lsp_min(block, length - offset);
+
+            ctx.nOffset         = offset;
+            ctx.nSamples        = to_do;
+            xc.process(&left.data()[offset], (channels > 1) ? &right.data()[offset] : NULL, to_do);
+
+            ref_ctx.nOffset     = offset;
+            ref_ctx.nSamples    = to_do;
+            ref[0].process(&left.data()[offset], to_do);
+            if (channels > 1)
+                ref[1].process(&right.data()[offset], to_do);
+
+            offset             += to_do;
+        }
+
+        check_buffers(label, &ctx);
+        check_buffers(label, &ref_ctx);
+        UTEST_ASSERT_MSG(left.valid(), "Left input buffer corrupted");
+        UTEST_ASSERT_MSG(right.valid(), "Right input buffer corrupted");
+
+        // Align the outputs by the latency of each crossover and compare the bands,
+        // the sum of bands should restore the delayed input
+        const size_t latency    = xc.latency();
+        const size_t ref_latency= ref[0].latency();
+        UTEST_ASSERT(latency == (size_t(1) << rank));
+        const size_t count      = length - lsp_max(latency, ref_latency);
+        FloatBuffer *inputs[2]  = { &left, &right };
+
+        for (size_t j=0; j<2; ++j)
+        {
+            const float *in         = inputs[j]->data();
+            for (size_t k=0; k<count; ++k)
+            {
+                float sum               = 0.0f;
+                for (size_t i=0; i<BANDS; ++i)
+                {
+                    const float v           = ctx.vBand[i][j]->data()[k + latency];
+                    const float r           = ref_ctx.vBand[i][j]->data()[k + ref_latency];
+                    sum                    += v;
+
+                    // Handlers of the right channel are not called in mono mode
+                    if ((j >= channels) && (v != 0.0f))
+                        UTEST_FAIL_MSG("Test '%s': band %d of the absent channel has data at sample %d",
+                            label, int(i), int(k));
+                    if ((j < channels) && (fabsf(v - r) > TOLERANCE))
+                        UTEST_FAIL_MSG("Test '%s': band %d channel %d differs from the reference at sample %d: %g vs %g",
+                            label, int(i), int(j), int(k), v, r);
+                }
+
+                const float expected    = (j < channels) ? in[k] : 0.0f;
+                if (fabsf(sum - expected) > TOLERANCE)
+                    UTEST_FAIL_MSG("Test '%s': sum of bands of channel %d differs from the input at sample %d: %g vs %g",
+                        label, int(j), int(k), sum, expected);
+            }
+        }
+
+        for (size_t j=0; j<channels; ++j)
+            ref[j].destroy();
+        xc.destroy();
+        for (size_t i=0; i<BANDS * 4; ++i)
+            delete bufs[i];
+    }
+
+    UTEST_MAIN
+    {
+        srand(0x5eed);
+
+        UTEST_FOREACH(rank, 8, 10, 12)
+        {
+            test_crossover(rank, 1);
+            test_crossover(rank, 2);
+        }
+    }
+
+UTEST_END